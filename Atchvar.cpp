@@ -0,0 +1,151 @@
+/*
+File:   Atchvar.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "Atchvar.h"
+#include <string.h>
+
+/* Where we are in a line, once the keyword is behind us. */
+#define ATCHVAR_LEAD   0   // Between numbers.
+#define ATCHVAR_SIGN   1   // Had a minus sign. A digit must follow.
+#define ATCHVAR_ZERO   2   // Had a leading zero. Might be the start of 0x.
+#define ATCHVAR_DEC    3
+#define ATCHVAR_HEX0   4   // Had 0x. A hex digit must follow.
+#define ATCHVAR_HEX    5
+
+
+static const char ATCHVAR_KEY[] = "ATCHVAR ";
+
+
+/* Returns the value of a hex digit, or -1. */
+static inline int8_t hex_value(char c) {
+  if ((c >= '0') && (c <= '9')) return c - '0';
+  c |= 0x20;
+  if ((c >= 'a') && (c <= 'f')) return c - 'a' + 10;
+  return -1;
+}
+
+
+int8_t parse_atchvar(const char* line, uint16_t len, Atchvar* out) {
+  uint16_t i = 0;
+  uint8_t  k = 0;
+
+  // Find the keyword. The only way a partial match can start over partway through
+  //   is on the second A: "ATCHVATCHVAR ".
+  while ((i < len) && (k < sizeof(ATCHVAR_KEY) - 1)) {
+    char c = line[i++];
+    if ((c >= 'a') && (c <= 'z')) c -= 0x20;
+    if (c == ATCHVAR_KEY[k])            k++;
+    else if ('A' == c)                  k = 1;
+    else if ((6 == k) && ('T' == c))    k = 2;
+    else                                k = 0;
+  }
+  if (k < sizeof(ATCHVAR_KEY) - 1) return -1;
+
+  memset(out, 0, sizeof(Atchvar));
+  uint8_t state = ATCHVAR_LEAD;
+  uint8_t n     = 0;       // Numbers read so far. The first is the var.
+  bool    comma = false;   // Had a comma since the last number.
+  bool    neg   = false;
+  int32_t acc   = 0;
+
+  while (true) {
+    char   c = (i < len) ? line[i] : '\0';
+    bool   end_of_num = (('\0' == c) || (' ' == c) || (',' == c) || ('\t' == c) || ('\r' == c) || ('\n' == c));
+    int8_t d;
+
+    switch (state) {
+      case ATCHVAR_LEAD:
+        if ((' ' == c) || ('\t' == c)) break;
+        if ((c >= '0') && (c <= '9')) {
+          acc   = c - '0';
+          state = ('0' == c) ? ATCHVAR_ZERO : ATCHVAR_DEC;
+          break;
+        }
+        if ('-' == c) {
+          neg   = true;
+          state = ATCHVAR_SIGN;
+          break;
+        }
+        if (',' == c) {
+          if ((n < 2) || comma) return -2;   // Commas only come between args.
+          comma = true;
+          break;
+        }
+        if (('\0' == c) || ('\r' == c) || ('\n' == c)) {
+          if ((0 == n) || comma) return -2;
+          out->argc = n - 1;
+          return 0;
+        }
+        return -2;
+
+      case ATCHVAR_SIGN:
+        if ((c < '0') || (c > '9')) return -2;
+        acc   = c - '0';
+        state = ('0' == c) ? ATCHVAR_ZERO : ATCHVAR_DEC;
+        break;
+
+      case ATCHVAR_ZERO:
+        if (('x' == c) || ('X' == c)) {
+          state = ATCHVAR_HEX0;
+          break;
+        }
+        state = ATCHVAR_DEC;   // A leading zero on a decimal number is fine.
+        // Fall through.
+      case ATCHVAR_DEC:
+        if ((c >= '0') && (c <= '9')) {
+          acc = (acc * 10) + (c - '0');
+          break;
+        }
+        if (!end_of_num) return -2;
+        break;
+
+      case ATCHVAR_HEX0:
+      case ATCHVAR_HEX:
+        d = hex_value(c);
+        if (d >= 0) {
+          acc   = (ATCHVAR_HEX0 == state) ? d : ((acc << 4) | d);
+          state = ATCHVAR_HEX;
+          break;
+        }
+        if ((ATCHVAR_HEX0 == state) || !end_of_num) return -2;
+        break;
+    }
+
+    if ((ATCHVAR_LEAD != state) && end_of_num) {
+      // That was the end of a number. Keep it, then look at c again as a separator.
+      if (neg) acc = -acc;
+      if (0 == n) {
+        out->var = (uint8_t) acc;
+      }
+      else {
+        if (n > ATCHVAR_MAX_ARGS) return -2;
+        out->args[n - 1] = acc;
+      }
+      n++;
+      comma = false;
+      neg   = false;
+      state = ATCHVAR_LEAD;
+      continue;
+    }
+    i++;
+  }
+}
@@ -0,0 +1,58 @@
+/*
+File:   Atchvar.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+Reads the ATCHVAR lines that the e-field box (and FrameStream's acks) put on the link:
+    ATCHVAR <var> <arg>[,<arg>[,<arg>]]
+
+The line is read once, front to back, by a small state machine, straight out of
+  whatever buffer it is sitting in. Nothing is copied and nothing is allocated.
+  Like strcasestr(), which this replaces, the keyword is found anywhere in the line,
+  in any case, so noise ahead of it on the link is harmless.
+
+Numbers are decimal, or hex with a leading 0x. Either may have a minus sign. Args
+  are split by commas or spaces. A line with more than ATCHVAR_MAX_ARGS args is
+  refused, rather than quietly cut short.
+*/
+
+
+#ifndef __MURUMLUX_ATCHVAR_H__
+#define __MURUMLUX_ATCHVAR_H__
+
+#include <inttypes.h>
+
+#define ATCHVAR_MAX_ARGS  3
+
+
+typedef struct atchvar_t {
+  uint8_t  var;                     // The <var> after the keyword.
+  uint8_t  argc;                    // How many args followed it.
+  int32_t  args[ATCHVAR_MAX_ARGS];  // Args that weren't given are zero.
+} Atchvar;
+
+
+/*
+* Returns 0 and fills *out if the line held a whole message.
+*   -1 if there was no ATCHVAR in it.
+*   -2 if there was, but what followed it was bad.
+*/
+int8_t parse_atchvar(const char* line, uint16_t len, Atchvar* out);
+
+#endif
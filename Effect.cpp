@@ -0,0 +1,198 @@
+/*
+File:   Effect.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "Effect.h"
+#include <Arduino.h>
+#include <StringBuilder.h>
+
+
+Effect::Effect(const char* n) {
+  name      = n;
+  budget_us = 0;
+  period_min_us = EFFECT_PERIOD_MIN_US;
+  period_max_us = EFFECT_PERIOD_MAX_US;
+  period_us     = EFFECT_PERIOD_MIN_US;
+  frames    = 0;
+  skipped   = 0;
+  dropped   = 0;
+  slices    = 0;
+  overruns  = 0;
+  last_us   = 0;
+  peak_us   = 0;
+  avg4_us   = 0;
+  slice_max_us = 0;
+  _skip     = 0;
+  _drawing  = false;
+  _spent    = 0;
+}
+
+
+void Effect::printDebug(StringBuilder* output) {
+  output->concatf("%-12s %6uus avg %6uus peak %6uus budget  %u frames, %u over, %u skipped, %u dropped\n",
+    name, avg4_us >> 2, peak_us, budget_us, frames, overruns, skipped, dropped);
+  output->concatf("\t\t%u slices, longest %uus  period %uus (%u-%uus)\n", slices, slice_max_us, period_us, period_min_us, period_max_us);
+}
+
+
+
+EffectRegistry::EffectRegistry() {
+  _count      = 0;
+  _current_id = 0;
+  _current    = NULL;
+  lockstep    = false;
+  frames_done = 0;
+}
+
+
+int8_t EffectRegistry::add(uint8_t id, Effect* effect, uint32_t budget_us, bool in_cycle, uint32_t period_min_us, uint32_t period_max_us) {
+  if (NULL == effect) return -1;
+  if (index_of(id) >= 0) return -2;
+  if (_count >= EFFECT_MAX_COUNT) return -3;
+  if ((0 == period_min_us) || (period_max_us < period_min_us)) return -4;
+  effect->budget_us     = budget_us;
+  effect->period_min_us = period_min_us;
+  effect->period_max_us = period_max_us;
+  effect->period_us     = period_min_us;
+  _list[_count].id       = id;
+  _list[_count].in_cycle = in_cycle;
+  _list[_count].effect   = effect;
+  _count++;
+  return 0;
+}
+
+
+int8_t EffectRegistry::index_of(uint8_t id) {
+  for (uint8_t i = 0; i < _count; i++) {
+    if (id == _list[i].id) return i;
+  }
+  return -1;
+}
+
+
+Effect* EffectRegistry::get(uint8_t id) {
+  int8_t i = index_of(id);
+  return (i < 0) ? NULL : _list[i].effect;
+}
+
+
+void EffectRegistry::select(uint8_t id) {
+  if ((id == _current_id) && (NULL != _current)) return;
+  if (NULL != _current) _current->end();
+  _current_id = id;
+  _current    = get(id);
+  if (NULL != _current) {
+    _current->_skip    = 0;
+    _current->_drawing = false;
+    _current->begin();
+  }
+}
+
+
+/*
+* Cycles in the order effects were registered. Anything that isn't in the cycle
+*   (or is running when it isn't) goes on to the first one that is.
+*/
+void EffectRegistry::next() {
+  int8_t from = index_of(_current_id);
+  for (uint8_t n = 1; n <= _count; n++) {
+    uint8_t i = (from < 0) ? (n - 1) : ((from + n) % _count);
+    if (_list[i].in_cycle && _list[i].effect->available()) {
+      select(_list[i].id);
+      return;
+    }
+  }
+}
+
+
+/*
+* Starts the next frame of the running effect, unless it is sitting out frames, or
+*   is still drawing the last one.
+*/
+void EffectRegistry::frame(uint32_t now_ms) {
+  Effect* e = _current;
+  if (NULL == e) return;
+  if (e->_drawing) {
+    e->dropped++;
+    return;
+  }
+  if (e->_skip) {
+    e->_skip--;
+    e->skipped++;
+    return;
+  }
+
+  uint32_t t0 = micros();
+  e->step(now_ms);
+  e->_spent   = micros() - t0;
+  e->_drawing = true;
+}
+
+
+/*
+* Gives the running effect one slice to draw in. Once its frame is done, we see what
+*   the whole thing cost. If it is running over budget, it sits out enough frames to
+*   bring it back under.
+*/
+bool EffectRegistry::slice(uint32_t slice_us) {
+  Effect* e = _current;
+  if ((NULL == e) || !e->_drawing) return false;
+
+  uint32_t t0 = micros();
+  bool done = e->render(t0 + slice_us);
+  uint32_t t = micros() - t0;
+  e->slices++;
+  if (t > e->slice_max_us) e->slice_max_us = t;
+  e->_spent += t;
+  if (!done) return true;
+
+  uint32_t cost = e->_spent;
+  e->_drawing = false;
+  e->frames++;
+  frames_done++;
+  e->last_us  = cost;
+  e->avg4_us += cost - (e->avg4_us >> 2);
+  if (cost > e->peak_us) e->peak_us = cost;
+  if ((0 != e->budget_us) && (cost > e->budget_us)) {
+    e->overruns++;
+    if (!lockstep) {
+      uint32_t skip = (e->avg4_us >> 2) / e->budget_us;
+      e->_skip = (skip > EFFECT_MAX_SKIP) ? EFFECT_MAX_SKIP : skip;
+    }
+  }
+  return true;
+}
+
+
+bool EffectRegistry::gesture(const LuxGesture* g) {
+  if (NULL == _current) return false;
+  return _current->onGesture(g);
+}
+
+
+void EffectRegistry::printDebug(StringBuilder* output) {
+  output->concat("\n-- Effects\n");
+  output->concatf("\tRunning:      %s (%u)\n", (NULL != _current) ? _current->name : "nothing", _current_id);
+  for (uint8_t i = 0; i < _count; i++) {
+    output->concatf("\t%c%u ", (_list[i].in_cycle ? ' ' : '*'), _list[i].id);
+    _list[i].effect->printDebug(output);
+  }
+}
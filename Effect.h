@@ -0,0 +1,175 @@
+/*
+File:   Effect.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+Things that can own the panel (plasma, paint, GoL, the logos...) are Effects. One
+  runs at a time, and the EffectRegistry decides which.
+
+An Effect is told when it takes the panel (begin()) and when it loses it (end()).
+  Each frame it is stepped and then rendered. Gestures from the e-field box are
+  offered to it first, and whatever it doesn't take falls through to the sketch.
+  A swipe, for instance, moves on to the next effect.
+
+Effects are registered under an id. The ids are the old mode numbers, which the
+  serial console still uses to pick one. Nothing else needs to know them, so a new
+  effect only needs to be registered.
+
+A frame is not drawn all at once. frame() starts one, and the main loop then calls
+  slice() between its rounds of input servicing. render() is called once per slice,
+  with the time the slice ends. It should draw a band at a time, check the clock
+  between bands, and return once the slice is over, picking up where it left off on
+  the next call. It returns true once the frame is done. So however long an effect's
+  frame takes, input waits no longer than a slice (and one band past it).
+A frame tick that comes while the last frame is still being drawn is dropped.
+
+Each effect has a budget: how long one frame of it may take, in microseconds, over
+  all of its slices. The registry measures every frame. An effect whose frames run
+  over budget, on average, is given fewer of them, so that the panel, serial traffic
+  and gestures still get their share of the CPU. An effect that can scale its work
+  (the plasma) can look at its budget and try to fit in it.
+
+Each effect also has bounds on its frame period. Where in them it runs is up to
+  the FrameGovernor, which remembers the period in the effect for the next time the
+  effect gets the panel.
+
+In lockstep (for replaying a gesture trace), nothing is ever skipped for being over
+  budget. The caller waits for busy() to clear before it starts the next frame, so
+  that every frame of a replay is drawn, however long each one takes.
+*/
+
+
+#ifndef __MURUMLUX_EFFECT_H__
+#define __MURUMLUX_EFFECT_H__
+
+#include <inttypes.h>
+#include <stdlib.h>
+
+#define EFFECT_MAX_COUNT     12
+#define EFFECT_MAX_SKIP       7    // Most frames in a row that an overrun can cost.
+#define EFFECT_SLICE_US     500    // How long a slice of rendering may hold off input.
+#define EFFECT_PERIOD_MIN_US  10000   // Frame period bounds, unless an effect is given its own.
+#define EFFECT_PERIOD_MAX_US  50000
+
+/* Gestures, as numbered by ATCHVAR. */
+#define GESTURE_POSITION     1
+#define GESTURE_AIRWHEEL     2
+#define GESTURE_SWIPE        3
+#define GESTURE_TAP          4
+#define GESTURE_DOUBLE_TAP   5
+#define GESTURE_TOUCH        6
+
+class StringBuilder;
+
+
+/*
+* A gesture, as it came from the e-field box. Position is the raw (x, y, z) from the
+*   box. Everything else has a single value.
+*/
+typedef struct lux_gesture_t {
+  uint8_t  kind;
+  int32_t  value;
+  uint16_t pos[3];
+  uint32_t stamp;    // micros() when it came in.
+} LuxGesture;
+
+
+class Effect {
+  public:
+    Effect(const char* name);
+
+    virtual void begin() {};                                   // We have the panel.
+    virtual void step(uint32_t /* now_ms */) {};               // Advance our state.
+    virtual bool render(uint32_t slice_end_us) = 0;            // Draw until then. True once the frame is done.
+    virtual bool onGesture(const LuxGesture*) {   return false;   };   // True if we took it.
+    virtual void end() {};                                     // Someone else has the panel.
+    virtual bool available() {   return true;   };             // False if there is nothing to show.
+
+    void printDebug(StringBuilder*);
+
+    const char* name;
+    uint32_t budget_us;      // Per frame.
+    uint32_t period_min_us;  // The frame period may be set anywhere in here...
+    uint32_t period_max_us;
+    uint32_t period_us;      // ...and this is where it was, the last time we ran.
+
+    /* Costs, as measured by the registry. */
+    uint32_t frames;
+    uint32_t skipped;        // Frames we gave up because of overruns...
+    uint32_t dropped;        // ...or because the last one wasn't done yet.
+    uint32_t slices;
+    uint32_t overruns;       // Frames over budget.
+    uint32_t last_us;
+    uint32_t peak_us;
+    uint32_t avg4_us;        // Averaged over the last few frames, times 4.
+    uint32_t slice_max_us;   // Longest single slice. How long input was held off.
+
+
+  private:
+    uint8_t  _skip;          // Frames left to sit out.
+    bool     _drawing;       // A frame is underway.
+    uint32_t _spent;         // On the frame underway, so far.
+
+    friend class EffectRegistry;
+};
+
+
+class EffectRegistry {
+  public:
+    EffectRegistry();
+
+    // 0 on success.
+    int8_t  add(uint8_t id, Effect*, uint32_t budget_us, bool in_cycle,
+                uint32_t period_min_us = EFFECT_PERIOD_MIN_US, uint32_t period_max_us = EFFECT_PERIOD_MAX_US);
+    Effect* get(uint8_t id);
+    inline Effect* current() {   return _current;      };
+    inline uint8_t currentId() { return _current_id;   };
+    inline uint8_t count() {     return _count;        };
+    inline Effect* at(uint8_t i) {   return (i < _count) ? _list[i].effect : NULL;   };
+    inline uint8_t idAt(uint8_t i) { return (i < _count) ? _list[i].id : 0;   };
+
+    void    select(uint8_t id);    // Nothing runs if nothing is registered there.
+    void    next();                // The next effect in the cycle that has something to show.
+    void    frame(uint32_t now_ms);  // Start a frame...
+    bool    slice(uint32_t slice_us);   // ...and draw some of it. True if there was anything to do.
+    bool    gesture(const LuxGesture*);   // False if the running effect didn't take it.
+    inline bool busy() {   return ((NULL != _current) && _current->_drawing);   };
+
+    void printDebug(StringBuilder*);
+
+    bool     lockstep;       // No skipping for being over budget.
+    uint32_t frames_done;    // Over all effects.
+
+
+  private:
+    typedef struct {
+      uint8_t id;
+      bool    in_cycle;
+      Effect* effect;
+    } EffectSlot;
+
+    EffectSlot _list[EFFECT_MAX_COUNT];
+    uint8_t    _count;
+    uint8_t    _current_id;
+    Effect*    _current;
+
+    int8_t  index_of(uint8_t id);
+};
+
+#endif
@@ -0,0 +1,103 @@
+/*
+File:   FrameGovernor.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "FrameGovernor.h"
+#include "Effect.h"
+#include <StringBuilder.h>
+
+
+FrameGovernor::FrameGovernor() {
+  enabled   = true;
+  headroom  = FRAME_GOVERNOR_HEADROOM;
+  raises    = 0;
+  backlogs  = 0;
+  _effect   = NULL;
+  _window_ms     = 0;
+  _window_frames = 0;
+  _fps10         = 0;
+}
+
+
+uint32_t FrameGovernor::begin(Effect* e, uint32_t now_ms) {
+  _effect        = e;
+  _window_ms     = now_ms;
+  _window_frames = 0;
+  _fps10         = 0;
+  return period();
+}
+
+
+uint32_t FrameGovernor::period() {
+  return (NULL == _effect) ? 0 : _effect->period_us;
+}
+
+
+uint32_t FrameGovernor::frameDone(uint32_t rx_waiting, uint8_t gestures_waiting, uint32_t now_ms) {
+  Effect* e = _effect;
+  if (NULL == e) return 0;
+
+  _window_frames++;
+  uint32_t window = now_ms - _window_ms;
+  if (window >= 1000) {
+    _fps10         = ((uint32_t) _window_frames * 10000) / window;
+    _window_ms     = now_ms;
+    _window_frames = 0;
+  }
+  if (!enabled) return e->period_us;
+
+  uint32_t cost = e->avg4_us >> 2;
+  if (e->last_us > cost) cost = e->last_us;
+  uint32_t p    = e->period_us;
+  uint32_t need = (cost * 100) / (100 - ((headroom < 100) ? headroom : 99));
+
+  if ((rx_waiting > FRAME_GOVERNOR_RX_BACKLOG) || (gestures_waiting > FRAME_GOVERNOR_GESTURE_BACKLOG)) {
+    // The frames leave input too little time, whatever they cost.
+    uint32_t step = p + (p >> 3);
+    if (need < step) need = step;
+    backlogs++;
+  }
+
+  if (need > p) {
+    p = need;
+    raises++;
+  }
+  else {
+    p -= (p - need) >> FRAME_GOVERNOR_EASE;
+  }
+
+  if (p < e->period_min_us) p = e->period_min_us;
+  if (p > e->period_max_us) p = e->period_max_us;
+  e->period_us = p;
+  return p;
+}
+
+
+void FrameGovernor::printDebug(StringBuilder* output) {
+  output->concat("\n-- FrameGovernor\n");
+  output->concatf("\tGoverning:     %s\n", enabled ? "yes" : "no (periods are held)");
+  output->concatf("\tHeadroom:      %u%%\n", headroom);
+  if (NULL != _effect) {
+    output->concatf("\tEffect:        %s, %uus (%u-%uus)\n", _effect->name, _effect->period_us, _effect->period_min_us, _effect->period_max_us);
+    output->concatf("\tFrame rate:    %u.%ufps, aiming at %u.%ufps\n", _fps10 / 10, _fps10 % 10, targetFps10() / 10, targetFps10() % 10);
+  }
+  output->concatf("\tRaises:        %u (%u for input)\n", raises, backlogs);
+}
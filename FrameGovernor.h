@@ -0,0 +1,88 @@
+/*
+File:   FrameGovernor.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+Picks the frame period for whichever effect has the panel.
+
+The aim is the shortest period the effect can keep up with, while leaving part of
+  every period (the headroom) for everything that isn't rendering: the e-field box's
+  link, gestures, the console, and the panel. After each frame, the period that the
+  frame's cost would need is worked out from the larger of what that frame cost and
+  what the last few cost. A period that is too short is lengthened to that at once.
+  One that is longer than it needs to be is brought down a fraction of the way per
+  frame, so a single cheap frame doesn't send it racing ahead.
+
+Input that piles up while we draw (bytes unread on the link, or gestures waiting for
+  a frame) means the headroom wasn't enough, whatever the costs say. Then the period
+  is lengthened a step every frame until the input is caught up.
+
+The period always stays within the effect's bounds (see Effect.h), and is kept in
+  the effect, so each one picks up where it left off when it gets the panel back.
+  The governor only decides the period. Running frames at it is up to the caller.
+*/
+
+
+#ifndef __MURUMLUX_FRAME_GOVERNOR_H__
+#define __MURUMLUX_FRAME_GOVERNOR_H__
+
+#include <inttypes.h>
+#include <stdlib.h>
+
+#define FRAME_GOVERNOR_HEADROOM        25   // Percent of each period not to render in.
+#define FRAME_GOVERNOR_EASE             4   // Come down 1/16th of the way per frame.
+#define FRAME_GOVERNOR_RX_BACKLOG      64   // Bytes unread after a frame. Two lines, or so.
+#define FRAME_GOVERNOR_GESTURE_BACKLOG  4   // Gestures waiting after a frame.
+
+class Effect;
+class StringBuilder;
+
+
+class FrameGovernor {
+  public:
+    FrameGovernor();
+
+    // The effect has the panel now. Returns the period it should run at.
+    uint32_t begin(Effect*, uint32_t now_ms);
+
+    // Once a frame is done. Returns the period the next one should run at.
+    uint32_t frameDone(uint32_t rx_waiting, uint8_t gestures_waiting, uint32_t now_ms);
+
+    uint32_t period();
+    inline Effect*  effect() {        return _effect;   };
+    inline uint32_t fps10() {         return _fps10;    };   // As measured, times 10...
+    inline uint32_t targetFps10() {   return (0 == period()) ? 0 : (10000000UL / period());   };   // ...and as aimed for.
+
+    void printDebug(StringBuilder*);
+
+    bool     enabled;    // When off, periods stay where they are.
+    uint8_t  headroom;   // Percent. Under 100.
+
+    uint32_t raises;     // Frames that lengthened the period...
+    uint32_t backlogs;   // ...because input was piling up.
+
+
+  private:
+    Effect*  _effect;
+    uint32_t _window_ms;       // The second we're counting frames over...
+    uint16_t _window_frames;
+    uint16_t _fps10;           // ...and what came of the last one.
+};
+
+#endif
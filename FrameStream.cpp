@@ -0,0 +1,453 @@
+/*
+File:   FrameStream.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "FrameStream.h"
+#include <RGBmatrixPanel.h>
+#include <StringBuilder.h>
+
+
+/* Decoder states */
+#define RECT_STATE_HEADER     0
+#define RECT_STATE_RUN        1
+#define RECT_STATE_PIXEL_LO   2
+#define RECT_STATE_PIXEL_HI   3
+
+/* Link states */
+#define LINK_STATE_IDLE       0
+#define LINK_STATE_TYPE       1
+#define LINK_STATE_SEQ        2
+#define LINK_STATE_LEN_LO     3
+#define LINK_STATE_LEN_HI     4
+#define LINK_STATE_PAYLOAD    5
+#define LINK_STATE_CSUM_LO    6
+#define LINK_STATE_CSUM_HI    7
+#define LINK_STATE_DISCARD    8
+
+
+/****************************************************************************************************
+* RectDecoder                                                                                       *
+****************************************************************************************************/
+
+RectDecoder::RectDecoder(RGBmatrixPanel* panel) {
+  _panel         = panel;
+  _palette       = NULL;
+  _palette_size  = 0;
+  pixels_written = 0;
+  reset();
+}
+
+
+void RectDecoder::reset() {
+  _state          = RECT_STATE_HEADER;
+  _hdr_idx        = 0;
+  _rect_remaining = 0;
+  _run_len        = 0;
+  _run_repeat     = false;
+}
+
+
+/*
+* Image coordinates are translated the same way set_logo() does it, so that anything
+*   encoded from the same source art as static_images.c lands the right way up.
+*/
+void RectDecoder::emit(uint16_t color) {
+  _panel->drawPixel(_row, (FRAME_IMAGE_WIDTH-1) - _col, color);
+  pixels_written++;
+  _rect_remaining--;
+  if (++_col == (_hdr[0] + _hdr[2])) {
+    _col = _hdr[0];
+    _row++;
+  }
+}
+
+
+void RectDecoder::take_pixel(uint16_t color) {
+  if (_run_repeat) {
+    while (_run_len > 0) {
+      emit(color);
+      _run_len--;
+    }
+  }
+  else {
+    emit(color);
+    _run_len--;
+  }
+
+  if (_run_len > 0) {
+    _state = RECT_STATE_PIXEL_LO;
+  }
+  else {
+    _state = (_rect_remaining > 0) ? RECT_STATE_RUN : RECT_STATE_HEADER;
+  }
+}
+
+
+int8_t RectDecoder::feed(uint8_t c) {
+  switch (_state) {
+    case RECT_STATE_HEADER:
+      _hdr[_hdr_idx++] = c;
+      if (4 == _hdr_idx) {
+        _hdr_idx = 0;
+        if ((0 == _hdr[2]) || (0 == _hdr[3])) return -1;
+        if ((_hdr[0] + _hdr[2]) > FRAME_IMAGE_WIDTH)  return -1;
+        if ((_hdr[1] + _hdr[3]) > FRAME_IMAGE_HEIGHT) return -1;
+        _col = _hdr[0];
+        _row = _hdr[1];
+        _rect_remaining = _hdr[2] * _hdr[3];
+        _state = RECT_STATE_RUN;
+      }
+      break;
+
+    case RECT_STATE_RUN:
+      _run_repeat = (c & 0x80);
+      _run_len    = (c & 0x7F) + 1;
+      if (_run_len > _rect_remaining) return -1;
+      _state = RECT_STATE_PIXEL_LO;
+      break;
+
+    case RECT_STATE_PIXEL_LO:
+      if (NULL != _palette) {
+        if (c >= _palette_size) return -1;
+        take_pixel(_palette[c]);
+      }
+      else {
+        _px_lo = c;
+        _state = RECT_STATE_PIXEL_HI;
+      }
+      break;
+
+    case RECT_STATE_PIXEL_HI:
+      take_pixel(_px_lo | (c << 8));
+      break;
+  }
+  return 0;
+}
+
+
+int8_t RectDecoder::feed(const uint8_t* buf, uint32_t len) {
+  for (uint32_t i = 0; i < len; i++) {
+    if (feed(*(buf + i))) return -1;
+  }
+  return 0;
+}
+
+
+
+/****************************************************************************************************
+* FrameStream                                                                                       *
+****************************************************************************************************/
+
+FrameStream::FrameStream(RGBmatrixPanel* panel) : _decoder(panel) {
+  frames_shown = 0;
+  keyframes    = 0;
+  deltas       = 0;
+  dropped      = 0;
+  corrupt      = 0;
+  late         = 0;
+  skipped      = 0;
+  bytes_rx     = 0;
+
+  _state        = LINK_STATE_IDLE;
+  _seq_valid    = false;
+  _have_base    = false;
+  _landed       = false;
+  _ack_pending  = false;
+  _ack_flags    = 0;
+  _last_seq     = 0;
+  _period_ms    = 0;
+  _sched_valid  = false;
+  _last_byte_ms = 0;
+  _skip         = 0;
+}
+
+
+void FrameStream::sum(uint8_t c) {
+  _sum_a = (_sum_a + c) % 255;
+  _sum_b = (_sum_b + _sum_a) % 255;
+}
+
+
+void FrameStream::ack(uint8_t seq, uint8_t flags) {
+  if (!_ack_pending) _ack_flags = 0;
+  _ack_flags  |= flags;
+  _ack_seq     = seq;
+  _ack_pending = true;
+}
+
+
+/*
+* Drop whatever packet was in progress. Nothing of it was drawn. But if it was a frame,
+*   it is one the next delta was made against, so we will need a keyframe.
+* What's left of it on the link is still binary, and mustn't reach the text parser.
+*   If we know how much that is, we skip exactly that much. If not, we skip to the
+*   next sync byte.
+*/
+void FrameStream::abandon() {
+  switch (_state) {
+    case LINK_STATE_PAYLOAD:  _skip = (_len - _idx) + 2;   break;
+    case LINK_STATE_CSUM_LO:  _skip = 2;                   break;
+    case LINK_STATE_CSUM_HI:  _skip = 1;                   break;
+    default:                  _skip = 0;                   break;
+  }
+  if (_skip && (FRAME_STREAM_TYPE_PARAMS != _type)) {
+    _have_base = false;
+    ack(_seq, FRAME_STREAM_ACK_WANT_KEY);
+  }
+  _state = LINK_STATE_DISCARD;
+}
+
+
+/*
+* Called once the header is complete. Decides if the payload is going to be drawn.
+*/
+void FrameStream::begin_packet() {
+  _idx      = 0;
+  _applying = false;
+
+  if (FRAME_STREAM_TYPE_PARAMS == _type) return;
+
+  if (_seq_valid) {
+    uint8_t gap = (uint8_t) (_seq - (uint8_t) (_last_seq + 1));
+    if (gap) {
+      dropped += gap;
+      _have_base = false;   // Whatever we missed, the next delta will not apply cleanly.
+    }
+  }
+  _seq_valid = true;
+  _last_seq  = _seq;
+
+  if ((FRAME_STREAM_TYPE_DELTA == _type) && !_have_base) {
+    dropped++;              // We can't use this one. Skip its payload and ask for a keyframe.
+    return;
+  }
+  _applying = true;
+}
+
+
+/*
+* The payload is only drawn from here, once the checksum has passed, and then all in
+*   one go. So the panel never shows part of a frame that is still on the wire, or
+*   any of one that turned out to be broken.
+*/
+void FrameStream::finish_packet(uint32_t now_ms) {
+  uint16_t csum = (_sum_b << 8) | _sum_a;
+  if (csum != _rx_csum) {
+    corrupt++;
+    if (_applying) _have_base = false;
+    ack(_seq, FRAME_STREAM_ACK_WANT_KEY);
+    return;
+  }
+
+  if (FRAME_STREAM_TYPE_PARAMS == _type) {
+    if (_len >= 2) {
+      _period_ms   = _payload[0] | (_payload[1] << 8);
+      _sched_valid = false;
+    }
+    ack(_seq, 0);
+    return;
+  }
+
+  if (!_applying) {
+    ack(_seq, FRAME_STREAM_ACK_WANT_KEY);
+    return;
+  }
+
+  uint32_t px = _decoder.pixels_written;
+  _decoder.reset();
+  if (_decoder.feed(_payload, _len) || !_decoder.idle()) {
+    corrupt++;
+    _have_base = false;
+    ack(_seq, FRAME_STREAM_ACK_WANT_KEY);
+    return;
+  }
+  if ((FRAME_STREAM_TYPE_KEY == _type) && ((_decoder.pixels_written - px) < (FRAME_IMAGE_WIDTH * FRAME_IMAGE_HEIGHT))) {
+    // It left some of the image as it was. That's no base for the deltas to come.
+    corrupt++;
+    _have_base = false;
+    ack(_seq, FRAME_STREAM_ACK_WANT_KEY);
+    return;
+  }
+
+  frames_shown++;
+  if (FRAME_STREAM_TYPE_KEY == _type) {
+    keyframes++;
+    if (_ack_pending) _ack_flags &= ~FRAME_STREAM_ACK_WANT_KEY;
+  }
+  else {
+    deltas++;
+  }
+  _have_base = true;
+  _landed    = true;
+
+  if (_period_ms) {
+    if (_sched_valid) {
+      // Where in time should this frame have landed, given the last one?
+      uint32_t due = _sched_ms + ((uint8_t) (_seq - _sched_seq)) * _period_ms;
+      if ((int32_t) (now_ms - (due + (_period_ms >> 1))) > 0) {
+        late++;
+        _sched_ms = now_ms;   // Re-anchor so that one stall is only counted once.
+      }
+      else {
+        _sched_ms = due;
+      }
+    }
+    else {
+      _sched_ms    = now_ms;
+      _sched_valid = true;
+    }
+    _sched_seq = _seq;
+  }
+  ack(_seq, 0);
+}
+
+
+/*
+* Feed every byte from the link through here before the text parser sees it.
+* Returns true if the byte belonged to a binary packet, in which case the caller
+*   should forget about it.
+*/
+bool FrameStream::accept(uint8_t c, uint32_t now_ms) {
+  if ((LINK_STATE_IDLE != _state) && ((now_ms - _last_byte_ms) > FRAME_STREAM_TIMEOUT)) {
+    if (LINK_STATE_DISCARD == _state) {
+      _state = LINK_STATE_IDLE;   // The link went quiet. Whatever comes now is new.
+    }
+    else {
+      corrupt++;
+      abandon();
+    }
+  }
+
+  if (LINK_STATE_DISCARD == _state) {
+    if ((0 == _skip) && (FRAME_STREAM_SYNC == c)) {
+      _state = LINK_STATE_IDLE;   // Found our footing. Start on the packet below.
+    }
+    else {
+      if (_skip && (0 == --_skip)) _state = LINK_STATE_IDLE;
+      skipped++;
+      _last_byte_ms = now_ms;
+      bytes_rx++;
+      return true;
+    }
+  }
+
+  if (LINK_STATE_IDLE == _state) {
+    if (FRAME_STREAM_SYNC != c) return false;
+    _sum_a = 0;
+    _sum_b = 0;
+    _state = LINK_STATE_TYPE;
+    _last_byte_ms = now_ms;
+    bytes_rx++;
+    return true;
+  }
+
+  _last_byte_ms = now_ms;
+  bytes_rx++;
+
+  switch (_state) {
+    case LINK_STATE_TYPE:
+      _type = c;
+      sum(c);
+      switch (_type) {
+        case FRAME_STREAM_TYPE_KEY:
+        case FRAME_STREAM_TYPE_DELTA:
+        case FRAME_STREAM_TYPE_PARAMS:
+          _state = LINK_STATE_SEQ;
+          break;
+        default:
+          corrupt++;
+          abandon();
+          break;
+      }
+      break;
+
+    case LINK_STATE_SEQ:
+      _seq = c;
+      sum(c);
+      _state = LINK_STATE_LEN_LO;
+      break;
+
+    case LINK_STATE_LEN_LO:
+      _len = c;
+      sum(c);
+      _state = LINK_STATE_LEN_HI;
+      break;
+
+    case LINK_STATE_LEN_HI:
+      _len |= (c << 8);
+      sum(c);
+      if (_len > FRAME_STREAM_MAX_PAYLOAD) {
+        corrupt++;
+        abandon();
+      }
+      else {
+        begin_packet();
+        _state = (_len > 0) ? LINK_STATE_PAYLOAD : LINK_STATE_CSUM_LO;
+      }
+      break;
+
+    case LINK_STATE_PAYLOAD:
+      sum(c);
+      _payload[_idx] = c;
+      if (++_idx == _len) _state = LINK_STATE_CSUM_LO;
+      break;
+
+    case LINK_STATE_CSUM_LO:
+      _rx_csum = c;
+      _state = LINK_STATE_CSUM_HI;
+      break;
+
+    case LINK_STATE_CSUM_HI:
+      _rx_csum |= (c << 8);
+      _state = LINK_STATE_IDLE;
+      finish_packet(now_ms);
+      break;
+  }
+  return true;
+}
+
+
+bool FrameStream::frameLanded() {
+  bool return_value = _landed;
+  _landed = false;
+  return return_value;
+}
+
+
+void FrameStream::writeAck(StringBuilder* output) {
+  if (_ack_pending) {
+    output->concatf("ATCHVAR 8 %u,%u,%u\r\n", _ack_seq, _ack_flags, FRAME_STREAM_WINDOW);
+    _ack_pending = false;
+  }
+}
+
+
+void FrameStream::printDebug(StringBuilder* output) {
+  output->concat("\n-- FrameStream\n");
+  output->concatf("\tFrames shown:  %u (%u key, %u delta)\n", frames_shown, keyframes, deltas);
+  output->concatf("\tDropped:       %u\n", dropped);
+  output->concatf("\tCorrupt:       %u\n", corrupt);
+  output->concatf("\tSkipped:       %u bytes (what was left of broken packets)\n", skipped);
+  output->concatf("\tLate:          %u  (host period %ums)\n", late, _period_ms);
+  output->concatf("\tBytes rx:      %u\n", bytes_rx);
+  output->concatf("\tPixels:        %u\n", _decoder.pixels_written);
+  output->concatf("\tHave base:     %s\n", _have_base ? "yes" : "no");
+}
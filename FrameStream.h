@@ -0,0 +1,185 @@
+/*
+File:   FrameStream.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+Binary frame streaming over the same link that carries the ATCHVAR text lines.
+
+A remote host pushes whole keyframes and dirty-rectangle deltas. Each payload is
+  held as it arrives, and only decoded into the render buffer once its checksum has
+  passed. The panel has no back buffer to spare (see RGBmatrixPanel), so this is how
+  frames are kept from tearing: nothing is drawn until all of it is here and good,
+  and then it is drawn in one go. That costs FRAME_STREAM_MAX_PAYLOAD bytes of RAM.
+
+Packet framing (all multi-byte fields are little-endian):
+  /------|------|-----|-----------|-------------------|---------------\
+  | 0xF5 | type | seq | len (u16) | payload (len)     | fletcher16    |
+  \------|------|-----|-----------|-------------------|---------------/
+  The checksum covers everything from type through the end of the payload.
+  0xF5 can never occur in the ASCII traffic, so the text parser and this class
+  can share the link without a mode switch. A packet that is broken off (it stalls,
+  or its header is bad) is abandoned, and what's left of it is still ours. If its
+  length was read, that many bytes are skipped. If not, everything up to the next
+  0xF5 is, or until the link has been quiet for FRAME_STREAM_TIMEOUT.
+
+Packet types:
+  0x01 Keyframe   Payload is a rect list that covers the whole image. One that doesn't
+                  is drawn, but isn't taken as a base for deltas.
+  0x02 Delta      Payload is a rect list to be applied over the prior frame.
+  0x03 Params     Payload is the host's frame period in ms (u16). Used for late-frame accounting.
+
+Rect list (shared with anything else that wants to draw encoded frames):
+  col, row, w, h   (one byte each, in image coordinates of the 96x64 logos)
+  ...followed by runs covering w*h pixels in row-major order. Each run has a header byte:
+    0x00-0x7F: Literal run of (n+1) pixels follow.
+    0x80-0xFF: A single pixel follows, repeated ((n & 0x7F)+1) times.
+  Pixels are RGB565 (2 bytes), or a single palette index if the decoder has a palette.
+
+Flow control:
+  After each packet, we answer on the same link with...
+    ATCHVAR 8 <seq>,<flags>,<window>
+  ...where bit 0 of flags is set if we want a keyframe (lost or broken delta). The host
+  should never have more than <window> unanswered frames in flight.
+*/
+
+
+#ifndef __MURUMLUX_FRAME_STREAM_H__
+#define __MURUMLUX_FRAME_STREAM_H__
+
+#include <inttypes.h>
+#include "FirmwareDefs.h"
+
+class RGBmatrixPanel;
+class StringBuilder;
+
+
+#define FRAME_IMAGE_WIDTH           96
+#define FRAME_IMAGE_HEIGHT          64
+
+#define FRAME_STREAM_SYNC         0xF5
+#define FRAME_STREAM_TYPE_KEY     0x01
+#define FRAME_STREAM_TYPE_DELTA   0x02
+#define FRAME_STREAM_TYPE_PARAMS  0x03
+
+#define FRAME_STREAM_WINDOW          2    // How many frames the host may have in flight.
+#define FRAME_STREAM_TIMEOUT       250    // A packet that stalls this long (ms) is abandoned.
+#define FRAME_STREAM_MAX_PAYLOAD   PROTOCOL_MTU
+
+#define FRAME_STREAM_ACK_WANT_KEY 0x01
+
+
+/*
+* Decodes a rect list into the panel. Feed it bytes in any size of bite. It keeps
+*   enough state to pick up where it left off.
+*/
+class RectDecoder {
+  public:
+    RectDecoder(RGBmatrixPanel*);
+
+    void    reset();                               // Call before each new payload.
+    int8_t  feed(uint8_t);                         // 0 on success. -1 if the payload is malformed.
+    int8_t  feed(const uint8_t* buf, uint32_t len);
+    inline void setPalette(const uint16_t* pal, uint16_t count) {  _palette = pal; _palette_size = count;  };
+    inline bool idle() {     return ((0 == _state) && (0 == _hdr_idx));   };   // True on a rect boundary.
+
+    uint32_t pixels_written;
+
+
+  private:
+    RGBmatrixPanel*  _panel;
+    const uint16_t*  _palette;      // If not NULL, pixels are single-byte indices into this.
+    uint16_t         _palette_size;
+
+    uint8_t   _state;
+    uint8_t   _hdr[4];              // col, row, w, h of the rect in progress.
+    uint8_t   _hdr_idx;
+    uint8_t   _col;                 // Write cursor.
+    uint8_t   _row;
+    uint16_t  _rect_remaining;      // Pixels left in this rect.
+    uint8_t   _run_len;             // Pixels left in this run.
+    bool      _run_repeat;
+    uint8_t   _px_lo;
+
+    void emit(uint16_t color);
+    void take_pixel(uint16_t color);
+};
+
+
+
+class FrameStream {
+  public:
+    FrameStream(RGBmatrixPanel*);
+
+    bool accept(uint8_t c, uint32_t now_ms);   // Returns true if the byte was ours.
+
+    bool frameLanded();                        // True once after each frame is fully drawn.
+    inline bool ackPending() {    return _ack_pending;    };
+    void writeAck(StringBuilder*);
+
+    void printDebug(StringBuilder*);
+
+    /* Stats */
+    uint32_t frames_shown;
+    uint32_t keyframes;
+    uint32_t deltas;
+    uint32_t dropped;      // Frames lost on the wire, and deltas we could not use because of it.
+    uint32_t corrupt;      // Bad checksum, malformed payload, or a packet that stalled.
+    uint32_t late;         // Frames finished more than half a period behind the host's schedule.
+    uint32_t skipped;      // Bytes of abandoned packets, kept from the text parser.
+    uint32_t bytes_rx;
+
+
+  private:
+    RectDecoder  _decoder;
+
+    uint8_t   _state;
+    uint8_t   _type;
+    uint8_t   _seq;
+    uint16_t  _len;
+    uint16_t  _idx;
+    uint16_t  _sum_a;          // Fletcher-16 accumulators.
+    uint16_t  _sum_b;
+    uint16_t  _rx_csum;
+    uint32_t  _last_byte_ms;
+    uint32_t  _skip;           // Bytes of an abandoned packet still to come. Zero means "up to the next sync".
+
+    bool      _applying;       // False if this packet's payload won't be drawn.
+    bool      _seq_valid;      // False until we have seen a frame. Gaps are counted from there.
+    bool      _have_base;      // False until we have shown a keyframe. Deltas need a base.
+    bool      _landed;
+    bool      _ack_pending;
+    uint8_t   _ack_seq;
+    uint8_t   _ack_flags;
+    uint8_t   _last_seq;
+
+    uint16_t  _period_ms;      // Host's frame period. Zero means "don't count late frames".
+    bool      _sched_valid;
+    uint8_t   _sched_seq;
+    uint32_t  _sched_ms;       // When we expected the last frame to land.
+
+    uint8_t   _payload[FRAME_STREAM_MAX_PAYLOAD];   // Held until the checksum passes.
+
+    void begin_packet();
+    void finish_packet(uint32_t now_ms);
+    void abandon();
+    void sum(uint8_t);
+    void ack(uint8_t seq, uint8_t flags);
+};
+
+#endif
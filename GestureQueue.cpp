@@ -0,0 +1,71 @@
+/*
+File:   GestureQueue.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "GestureQueue.h"
+#include <StringBuilder.h>
+
+
+GestureQueue::GestureQueue() {
+  _head     = 0;
+  _count    = 0;
+  posted    = 0;
+  coalesced = 0;
+  dropped   = 0;
+}
+
+
+bool GestureQueue::post(const LuxGesture* g) {
+  posted++;
+  if ((GESTURE_POSITION == g->kind) && (_count > 0)) {
+    LuxGesture* last = &_list[(_head + _count - 1) % GESTURE_QUEUE_SIZE];
+    if (GESTURE_POSITION == last->kind) {
+      *last = *g;
+      coalesced++;
+      return true;
+    }
+  }
+  if (_count >= GESTURE_QUEUE_SIZE) {
+    dropped++;
+    return false;
+  }
+  _list[(_head + _count) % GESTURE_QUEUE_SIZE] = *g;
+  _count++;
+  return true;
+}
+
+
+bool GestureQueue::take(LuxGesture* g) {
+  if (0 == _count) return false;
+  *g = _list[_head];
+  _head = (_head + 1) % GESTURE_QUEUE_SIZE;
+  _count--;
+  return true;
+}
+
+
+void GestureQueue::printDebug(StringBuilder* output) {
+  output->concat("\n-- GestureQueue\n");
+  output->concatf("\tWaiting:       %u of %u\n", _count, GESTURE_QUEUE_SIZE);
+  output->concatf("\tPosted:        %u\n", posted);
+  output->concatf("\tCoalesced:     %u\n", coalesced);
+  output->concatf("\tDropped:       %u\n", dropped);
+}
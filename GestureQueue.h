@@ -0,0 +1,66 @@
+/*
+File:   GestureQueue.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+Gestures wait here between the link and the frame that acts on them.
+
+The e-field box sends positions far faster than we draw frames, and the link can
+  hand us a burst of them at once. Only the newest position means anything by the
+  time a frame comes around. So a position that comes in right behind another one
+  takes its place, rather than queueing up behind it. Everything else (swipes, taps,
+  touches, the wheel) is kept, in order. A position on either side of one of those
+  is kept too, so that a tap still lands where the hand was when it tapped.
+
+The queue is drained once per frame, so the work done for input in a frame is
+  bounded by the queue's size, however fast the link runs. If it fills, the newest
+  gesture is lost and counted.
+*/
+
+
+#ifndef __MURUMLUX_GESTURE_QUEUE_H__
+#define __MURUMLUX_GESTURE_QUEUE_H__
+
+#include "Effect.h"
+
+#define GESTURE_QUEUE_SIZE   16
+
+
+class GestureQueue {
+  public:
+    GestureQueue();
+
+    bool post(const LuxGesture*);   // False if there was no room for it.
+    bool take(LuxGesture*);         // False if there was nothing waiting.
+    inline uint8_t count() {   return _count;   };
+
+    void printDebug(StringBuilder*);
+
+    uint32_t posted;
+    uint32_t coalesced;   // Positions that were replaced by a newer one.
+    uint32_t dropped;
+
+
+  private:
+    LuxGesture _list[GESTURE_QUEUE_SIZE];
+    uint8_t    _head;     // Oldest.
+    uint8_t    _count;
+};
+
+#endif
@@ -0,0 +1,485 @@
+/*
+File:   GoLBoard.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "GoLBoard.h"
+#include <stdlib.h>
+#include <StringBuilder.h>
+
+
+/*
+* Every cell's neighbor to the west (col - 1), lined up with the cell.
+*/
+static inline uint32_t west(const uint32_t* r, int k) {
+  return (r[k] << 1) | (r[(k + GOL_WORDS_PER_ROW - 1) % GOL_WORDS_PER_ROW] >> 31);
+}
+
+/*
+* Every cell's neighbor to the east (col + 1), lined up with the cell.
+*/
+static inline uint32_t east(const uint32_t* r, int k) {
+  return (r[k] >> 1) | (r[(k + 1) % GOL_WORDS_PER_ROW] << 31);
+}
+
+
+GoLBoard::GoLBoard() {
+  _age      = NULL;
+  _stepping = false;
+  _rule.parse(LIFE_RULE_LIST[0]);
+  clear();
+}
+
+
+GoLBoard::~GoLBoard() {
+  if (_age) free(_age);
+}
+
+
+void GoLBoard::clear() {
+  _stepping = false;
+  memset(_cells, 0, sizeof(_cells));
+  if (_age) memset(_age, 0, GOL_AGE_PLANES * sizeof(*_age));
+  _cur       = 0;
+  memset(_changed, 0, sizeof(_changed));
+  memset(_edge_w,  0, sizeof(_edge_w));
+  memset(_edge_e,  0, sizeof(_edge_e));
+  redrawAll();
+  generation = 0;
+  tiles_evaluated = 0;
+  rehash();
+}
+
+
+/*
+* Hash the current generation from scratch, and forget the history.
+*/
+void GoLBoard::rehash() {
+  _hash = 0;
+  for (int j = 0; j < GOL_BOARD_HEIGHT; j++) {
+    for (int k = 0; k < GOL_WORDS_PER_ROW; k++) {
+      _hash ^= term(_cells[_cur][j][k], j, k);
+    }
+  }
+  memset(_history, 0, sizeof(_history));
+  _hist_idx   = 0;
+  _hist_depth = 0;
+  _period     = 0;
+}
+
+
+void GoLBoard::mark_all_changed() {
+  for (int k = 0; k < GOL_WORDS_PER_ROW; k++) {
+    for (int b = 0; b < GOL_ROW_BLOCKS; b++) {
+      _changed[k][b] = GOL_ALL_ROWS;
+      _edge_w[k][b]  = GOL_ALL_ROWS;
+      _edge_e[k][b]  = GOL_ALL_ROWS;
+    }
+  }
+}
+
+
+/*
+* Returns -1 if the rule needs age planes, and there wasn't memory for them. The
+*   old rule stays in force in that case.
+*/
+int8_t GoLBoard::setRule(const LifeRule* nu_rule) {
+  if (nu_rule->states > 2) {
+    if (NULL == _age) {
+      _age = (uint32_t (*)[GOL_BOARD_HEIGHT][GOL_WORDS_PER_ROW]) malloc(GOL_AGE_PLANES * sizeof(*_age));
+      if (NULL == _age) return -1;
+    }
+    memset(_age, 0, GOL_AGE_PLANES * sizeof(*_age));
+  }
+  else if (_age) {
+    free(_age);
+    _age = NULL;
+  }
+  _rule = *nu_rule;
+  // The other buffer no longer follows from this one under the rule in force. Any
+  //   generation underway is forgotten.
+  _stepping = false;
+  mark_all_changed();
+  redrawAll();
+  rehash();
+  return 0;
+}
+
+
+void GoLBoard::randomize() {
+  clear();
+  for (int j = 0; j < GOL_BOARD_HEIGHT; j++) {
+    for (int k = 0; k < GOL_WORDS_PER_ROW; k++) {
+      // rand() might only give us 15 bits.
+      _cells[_cur][j][k] = ((uint32_t) (rand() & 0x7FFF) << 17) ^ ((uint32_t) (rand() & 0x7FFF) << 2) ^ (rand() & 3);
+    }
+  }
+  mark_all_changed();
+  rehash();
+}
+
+
+void GoLBoard::set(uint16_t row, uint16_t col) {
+  if (_stepping) step();   // Half a generation can't be hashed or evaluated sensibly.
+  uint8_t  k   = col >> 5;
+  uint32_t bit = ((uint32_t) 1 << (col & 0x1F));
+  uint64_t row_bit = (1ULL << (row & 0x3F));
+  _hash ^= term(_cells[_cur][row][k], row, k);
+  _cells[_cur][row][k] |= bit;
+  if (_age) {
+    for (int p = 0; p < GOL_AGE_PLANES; p++) _age[p][row][k] &= ~bit;
+  }
+  _hash ^= term(_cells[_cur][row][k], row, k);
+  _changed[k][row >> 6] |= row_bit;
+  _redraw[k][row >> 6]  |= row_bit;
+  if (0  == (col & 0x1F)) _edge_w[k][row >> 6] |= row_bit;
+  if (31 == (col & 0x1F)) _edge_e[k][row >> 6] |= row_bit;
+}
+
+
+uint32_t GoLBoard::span(uint16_t row, uint16_t col, uint8_t n) {
+  const uint32_t* r = _cells[_cur][row];
+  uint8_t  k   = col >> 5;
+  uint8_t  b   = col & 0x1F;
+  uint32_t ret = r[k] >> b;
+  if (b) ret |= r[(k + 1) % GOL_WORDS_PER_ROW] << (32 - b);
+  return (n < 32) ? (ret & ((1UL << n) - 1)) : ret;
+}
+
+
+uint8_t GoLBoard::age(uint16_t row, uint16_t col) {
+  uint8_t ret = 0;
+  if (_age) {
+    for (int p = 0; p < GOL_AGE_PLANES; p++) {
+      ret |= ((_age[p][row][col >> 5] >> (col & 0x1F)) & 1) << p;
+    }
+  }
+  return ret;
+}
+
+
+/*
+* Neighbor counts for word k of a row, in bit-slices. See LifeRule.h.
+*/
+static inline void count_moore(const uint32_t* above, const uint32_t* here, const uint32_t* below, int k, uint32_t c[4]) {
+  life_count_moore(west(above, k), above[k], east(above, k),
+                   west(here, k), east(here, k),
+                   west(below, k), below[k], east(below, k), c);
+}
+
+static inline void count_vn(const uint32_t* above, const uint32_t* here, const uint32_t* below, int k, uint32_t c[4]) {
+  life_count_vn(above[k], below[k], west(here, k), east(here, k), c);
+}
+
+
+/*
+* Selecting from a count set known at compile time. The empty terms fold away, so
+*   Conway's birth rule comes down to a single minterm.
+*/
+template <uint16_t SET> static inline uint32_t select_group(uint8_t g, const uint32_t lo[4], uint32_t hi) {
+  if (0 == ((SET >> (g << 2)) & 0x0F)) return 0;
+  return hi & ((((SET >> ((g << 2) + 0)) & 1) ? lo[0] : 0) |
+               (((SET >> ((g << 2) + 1)) & 1) ? lo[1] : 0) |
+               (((SET >> ((g << 2) + 2)) & 1) ? lo[2] : 0) |
+               (((SET >> ((g << 2) + 3)) & 1) ? lo[3] : 0));
+}
+
+template <uint16_t SET> static inline uint32_t select_fixed(const uint32_t lo[4], const uint32_t hi[3]) {
+  return (select_group<SET>(0, lo, hi[0]) | select_group<SET>(1, lo, hi[1]) | select_group<SET>(2, lo, hi[2]));
+}
+
+
+/*
+* A rule that was parsed at runtime.
+*/
+class CompiledRule {
+  public:
+    CompiledRule(const LifeRule* r) :
+      vn(LIFE_NEIGHBORS_VN == r->neighborhood), states(r->states), _b(r->b_terms), _s(r->s_terms) {};
+
+    inline uint32_t birth(const uint32_t lo[4], const uint32_t hi[3]) const {     return life_select(&_b, lo, hi);   };
+    inline uint32_t survive(const uint32_t lo[4], const uint32_t hi[3]) const {   return life_select(&_s, lo, hi);   };
+
+    const bool    vn;
+    const uint8_t states;
+
+  private:
+    const LifeTerms _b;   // Copies, so that the compiler needn't reload them after every store to the board.
+    const LifeTerms _s;
+};
+
+/*
+* One of the built-in rules. Everything about it is a constant, so step_words()
+*   gets compiled once for each of these with the rule folded into the kernel.
+*/
+template <uint16_t B, uint16_t S, uint8_t C, char N> class FixedRule {
+  public:
+    inline uint32_t birth(const uint32_t lo[4], const uint32_t hi[3]) const {     return select_fixed<B>(lo, hi);   };
+    inline uint32_t survive(const uint32_t lo[4], const uint32_t hi[3]) const {   return select_fixed<S>(lo, hi);   };
+
+    static const bool    vn     = (LIFE_NEIGHBORS_VN == N);
+    static const uint8_t states = C;
+};
+
+
+/*
+* Grows a set of rows by one in each direction, wrapping like the board does. The
+*   rows are in blocks of 64, so bits carry across from the neighboring blocks.
+*/
+void GoLBoard::spread(const uint64_t* rows, uint64_t* out) {
+#if (GOL_ROW_BLOCKS == 1)
+  uint64_t up   = (rows[0] >> 1) | ((rows[0] & 1) << (GOL_BOARD_HEIGHT - 1));
+  uint64_t down = ((rows[0] << 1) & GOL_ALL_ROWS) | (rows[0] >> (GOL_BOARD_HEIGHT - 1));
+  out[0] = (rows[0] | up | down);
+#else
+  for (int b = 0; b < GOL_ROW_BLOCKS; b++) {
+    uint64_t up   = (rows[b] >> 1) | (rows[(b + 1) % GOL_ROW_BLOCKS] << 63);
+    uint64_t down = (rows[b] << 1) | (rows[(b + GOL_ROW_BLOCKS - 1) % GOL_ROW_BLOCKS] >> 63);
+    out[b] = (rows[b] | up | down);
+  }
+#endif
+}
+
+
+/*
+* Evaluates the flagged words under the given rule, and flags what changed.
+*/
+template <class R> void GoLBoard::step_words(const R& rule, uint8_t k0, uint8_t k1) {
+  uint32_t (*src)[GOL_WORDS_PER_ROW] = _cells[_cur];
+  uint32_t (*dst)[GOL_WORDS_PER_ROW] = _cells[1 - _cur];
+  uint32_t hash      = _hash;
+  uint32_t evaluated = 0;
+
+  for (int k = k0; k < k1; k++) {
+    for (int blk = 0; blk < GOL_ROW_BLOCKS; blk++) {
+      uint64_t rows   = _eval[k][blk];   // Everything else already agrees in both buffers.
+      uint64_t delta  = 0;
+      uint64_t edge_w = 0;
+      uint64_t edge_e = 0;
+      while (rows) {
+        int b = __builtin_ctzll(rows);
+        int j = (blk << 6) + b;
+        rows &= rows - 1;
+        const uint32_t* above = src[(j + GOL_BOARD_HEIGHT - 1) % GOL_BOARD_HEIGHT];
+        const uint32_t* below = src[(j + 1) % GOL_BOARD_HEIGHT];
+        uint32_t c[4];
+        if (rule.vn) {
+          count_vn(above, src[j], below, k, c);
+        }
+        else {
+          count_moore(above, src[j], below, k, c);
+        }
+
+        uint32_t lo[4];
+        uint32_t hi[3];
+        life_decode(c, lo, hi);
+        uint32_t here = src[j][k];
+        uint32_t kept = here & rule.survive(lo, hi);
+        uint32_t nu;
+        uint32_t diff;
+        if (rule.states > 2) {
+          // Ages are updated in place. Nothing but this cell looks at its age.
+          uint32_t g0 = _age[0][j][k];
+          uint32_t g1 = _age[1][j][k];
+          uint32_t g2 = _age[2][j][k];
+          uint32_t dying = g0 | g1 | g2;
+          nu = kept | (rule.birth(lo, hi) & ~here & ~dying);
+
+          // Dying cells age by one, and are dead once they reach the state count.
+          uint32_t carry = g0 & dying;
+          uint32_t n0 = g0 ^ dying;
+          uint32_t n1 = g1 ^ carry;
+          uint32_t n2 = g2 ^ (g1 & carry);
+          uint8_t  last = rule.states - 1;
+          uint32_t expired = dying & ~((n0 ^ ((last & 1) ? 0xFFFFFFFF : 0)) |
+                                       (n1 ^ ((last & 2) ? 0xFFFFFFFF : 0)) |
+                                       (n2 ^ ((last & 4) ? 0xFFFFFFFF : 0)));
+          n0 = (n0 & ~expired) | (here & ~kept);   // The newly dying start at age 1.
+          n1 &= ~expired;
+          n2 &= ~expired;
+          diff = (nu ^ here) | (n0 ^ g0) | (n1 ^ g1) | (n2 ^ g2);
+          if (diff) {
+            hash ^= term(here, j, k);
+            _age[0][j][k] = n0;
+            _age[1][j][k] = n1;
+            _age[2][j][k] = n2;
+            hash ^= term(nu, j, k);
+          }
+          dst[j][k] = nu;
+        }
+        else {
+          nu   = kept | (rule.birth(lo, hi) & ~here);
+          diff = nu ^ here;
+          if (diff) {
+            hash ^= mix((j * GOL_WORDS_PER_ROW) + k, here) ^ mix((j * GOL_WORDS_PER_ROW) + k, nu);
+          }
+          dst[j][k] = nu;
+        }
+
+        if (diff) {
+          delta |= (1ULL << b);
+          if (diff & 0x00000001) edge_w |= (1ULL << b);
+          if (diff & 0x80000000) edge_e |= (1ULL << b);
+        }
+        evaluated++;
+      }
+      _changed[k][blk] = delta;
+      _edge_w[k][blk]  = edge_w;
+      _edge_e[k][blk]  = edge_e;
+      _redraw[k][blk] |= delta;
+    }
+  }
+  _hash = hash;
+  tiles_evaluated += evaluated;
+}
+
+
+/*
+* Rules with a FixedRule twin get the folded kernel. Anything else still runs
+*   bit-sliced, and only pays for the minterms its count sets use.
+*/
+#define GOL_FIXED_RULE(b, s, c, n) \
+  if ((b == _rule.birth) && (s == _rule.survive) && (c == _rule.states) && (n == _rule.neighborhood)) { \
+    step_words(FixedRule<b, s, c, n>(), k0, k1); \
+  } else
+
+void GoLBoard::step() {
+  while (!stepSome(GOL_WORDS_PER_ROW)) {}
+}
+
+
+/*
+* A generation is done a few columns of words at a time. Which tiles to evaluate is
+*   settled up front, from last generation's changes, before any of them are
+*   overwritten. Cells are only written to the other buffer until the last column
+*   is done and the buffers flip, so the board reads as the current generation
+*   throughout. Dying ages are the exception, as they are updated in place.
+*/
+bool GoLBoard::stepSome(uint8_t words) {
+  if (!_stepping) {
+    _history[_hist_idx] = _hash;
+    _hist_idx = (_hist_idx + 1) % GOL_HASH_HISTORY;
+    if (_hist_depth < GOL_HASH_HISTORY) _hist_depth++;
+
+    // A word's neighbors are the rows above and below, and the facing edges of
+    //   the words beside it.
+    for (int k = 0; k < GOL_WORDS_PER_ROW; k++) {
+      uint64_t rows[GOL_ROW_BLOCKS];
+      for (int b = 0; b < GOL_ROW_BLOCKS; b++) {
+        rows[b] = _changed[k][b] |
+                  _edge_e[(k + GOL_WORDS_PER_ROW - 1) % GOL_WORDS_PER_ROW][b] |
+                  _edge_w[(k + 1) % GOL_WORDS_PER_ROW][b];
+        // Tiles that changed last time need one more redraw to lose their birth/death colors.
+        _redraw[k][b] |= _changed[k][b];
+      }
+      spread(rows, _eval[k]);
+    }
+    _step_k   = 0;
+    _stepping = true;
+  }
+
+  uint8_t k0 = _step_k;
+  uint8_t k1 = ((GOL_WORDS_PER_ROW - k0) > words) ? (k0 + words) : GOL_WORDS_PER_ROW;
+
+  // These mirror LIFE_RULE_LIST.
+  GOL_FIXED_RULE(0x0008, 0x000C, 2, LIFE_NEIGHBORS_MOORE)   // B3/S23
+  GOL_FIXED_RULE(0x0008, 0x000C, 2, LIFE_NEIGHBORS_VN)      // B3/S23V
+  GOL_FIXED_RULE(0x0048, 0x000C, 2, LIFE_NEIGHBORS_MOORE)   // B36/S23
+  GOL_FIXED_RULE(0x01C8, 0x01D8, 2, LIFE_NEIGHBORS_MOORE)   // B3678/S34678
+  GOL_FIXED_RULE(0x0004, 0x0000, 2, LIFE_NEIGHBORS_MOORE)   // B2/S
+  GOL_FIXED_RULE(0x0004, 0x0000, 3, LIFE_NEIGHBORS_MOORE)   // B2/S/C3
+  GOL_FIXED_RULE(0x0004, 0x0038, 4, LIFE_NEIGHBORS_MOORE)   // B2/S345/C4
+  GOL_FIXED_RULE(0x0008, 0x003E, 2, LIFE_NEIGHBORS_MOORE)   // B3/S12345
+  {
+    step_words(CompiledRule(&_rule), k0, k1);
+  }
+
+  _step_k = k1;
+  if (k1 < GOL_WORDS_PER_ROW) return false;
+
+  _stepping = false;
+  _cur = 1 - _cur;
+  generation++;
+
+  // Walk back through the ring, most recent first. The ring is forgotten whenever
+  //   the board is rehashed, so don't look further back than it has been filled.
+  _period = 0;
+  for (uint8_t p = 1; p <= _hist_depth; p++) {
+    if (_history[(_hist_idx + GOL_HASH_HISTORY - p) % GOL_HASH_HISTORY] == _hash) {
+      _period = p;
+      break;
+    }
+  }
+  return true;
+}
+
+
+/*
+* The prior generation is left as it was, so a jump is drawn with the same
+*   birth/death colors as a step. Nothing is known about what changes next.
+*/
+void GoLBoard::commit(uint32_t gens) {
+  _stepping = false;   // The other buffer was overwritten.
+  _cur = 1 - _cur;
+  generation += gens;
+  if (_age) memset(_age, 0, GOL_AGE_PLANES * sizeof(*_age));
+  mark_all_changed();
+  redrawAll();
+  rehash();
+}
+
+
+bool GoLBoard::stable() {
+  for (int k = 0; k < GOL_WORDS_PER_ROW; k++) {
+    for (int b = 0; b < GOL_ROW_BLOCKS; b++) {
+      if (_changed[k][b]) return false;
+    }
+  }
+  return true;
+}
+
+
+void GoLBoard::redrawAll() {
+  for (int k = 0; k < GOL_WORDS_PER_ROW; k++) {
+    for (int b = 0; b < GOL_ROW_BLOCKS; b++) _redraw[k][b] = GOL_ALL_ROWS;
+  }
+}
+
+
+void GoLBoard::clearRedraw() {
+  memset(_redraw, 0, sizeof(_redraw));
+}
+
+
+void GoLBoard::printDebug(StringBuilder* output) {
+  output->concat("\n-- GoLBoard\n");
+  output->concatf("\tGeneration:    %u (", generation);
+  _rule.printRule(output);
+  output->concat(")\n");
+  uint32_t active = 0;
+  for (int k = 0; k < GOL_WORDS_PER_ROW; k++) {
+    for (int b = 0; b < GOL_ROW_BLOCKS; b++) active += __builtin_popcountll(_changed[k][b]);
+  }
+  output->concatf("\tActive tiles:  %u of %u\n", active, GOL_TILE_COUNT);
+  output->concatf("\tHash:          0x%08x (period %u)\n", _hash, _period);
+  if (generation > 0) {
+    output->concatf("\tEvaluated:     %u%% of a full sweep\n", (uint32_t) (((uint64_t) tiles_evaluated * 100) / ((uint64_t) generation * GOL_TILE_COUNT)));
+  }
+}
@@ -0,0 +1,223 @@
+/*
+File:   GoLBoard.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+A bit-packed Life-like cellular automaton on a torus. The rule is a LifeRule, and
+  defaults to Conway's Game of Life.
+
+Each row of the board is packed into 32-bit words, one cell per bit. Bit b of
+  word k is the cell in column (k*32)+b. Neighbor counts for a whole word of cells
+  are found at once with a handful of bitwise adders, so a generation costs a few
+  dozen instructions per 32 cells rather than eight wrapped loads per cell.
+
+The neighbor count comes out as four bit-slices (ones, twos, fours, eights), and
+  the rule is applied to those as a few minterms compiled from its count sets.
+  Rules with more than two states keep each cell's dying age in three more
+  bit-planes, and advance them with a bit-sliced increment.
+
+Wrap-around at the left and right edges is done by carrying bits between the
+  words of a row as it is rotated, so the width must be a whole number of words.
+  Top and bottom wrap by row index.
+
+The board is the whole universe, and is much larger than the panel. The sketch
+  shows a viewport into it, so that patterns have room to run before they meet
+  themselves coming around the torus. At 512x512, the two buffers cost 64KB.
+
+The board is double-buffered. Stepping writes the next generation into the other
+  buffer and flips, so the prior generation is always on hand for drawing
+  birth/death colors without copying anything.
+Dying ages (for Generations rules) are not double-buffered. A cell's next age only
+  depends on its own age, so they are updated in place. They are only allocated
+  while such a rule is in force.
+
+A generation can also be done a few columns of words at a time (stepSome()), so
+  that a caller can give up the CPU part way through one. Setting a cell finishes
+  the generation underway first.
+
+The board is also cut into tiles, each one word of one row (32 cells). A cell can
+  only change if it or one of its neighbors changed in the last generation, so only
+  tiles that changed (or border one that did) are evaluated. Everything else is
+  already identical in both buffers, and is left alone. Once the board settles
+  into still-lifes and a few blinkers, a generation costs a small fraction of a
+  full sweep. The same flags tell the renderer which tiles might have anything new
+  to show.
+Tile flags are kept as one bit per row, in blocks of 64 rows, for each word of the
+  row. A tile only wakes the tiles beside it if a cell on that edge changed.
+
+Each generation also gets a hash: the XOR of a mix of every word with its position.
+  When a word changes, its old term is XOR'd out and its new one in, so the hash
+  costs nothing for the parts of the board that are quiet. The last few hashes are
+  kept in a ring. A match means the board has come back to an earlier state, and
+  the distance back is the period of the cycle it is stuck in. That catches
+  blinkers, pulsars and the like, and not just boards that stopped changing.
+  Cycles longer than GOL_HASH_HISTORY (gliders lapping the torus) aren't caught.
+
+Rows and columns here are the same as the old int[row][col] board: a row runs
+  along the y-axis of drawPixel(), and the row index is the x-axis.
+*/
+
+
+#ifndef __MURUMLUX_GOL_BOARD_H__
+#define __MURUMLUX_GOL_BOARD_H__
+
+#include <inttypes.h>
+#include <string.h>
+#include "LifeRule.h"
+
+#ifndef GOL_BOARD_WIDTH
+  #define GOL_BOARD_WIDTH  512
+#endif
+#ifndef GOL_BOARD_HEIGHT
+  #define GOL_BOARD_HEIGHT 512
+#endif
+
+#define GOL_WORDS_PER_ROW  (GOL_BOARD_WIDTH / 32)
+#define GOL_TILE_COUNT     (GOL_BOARD_HEIGHT * GOL_WORDS_PER_ROW)
+#define GOL_ROW_BLOCKS     ((GOL_BOARD_HEIGHT + 63) / 64)
+#if (GOL_BOARD_HEIGHT >= 64)
+  #define GOL_ALL_ROWS     0xFFFFFFFFFFFFFFFFULL
+#else
+  #define GOL_ALL_ROWS     ((1ULL << GOL_BOARD_HEIGHT) - 1)
+#endif
+
+#if ((GOL_BOARD_WIDTH % 32) != 0)
+  #error GOL_BOARD_WIDTH must be a multiple of 32.
+#endif
+#if (GOL_WORDS_PER_ROW > 32)
+  #error GOL_BOARD_WIDTH must be no more than 1024.
+#endif
+#if ((GOL_BOARD_HEIGHT > 64) && ((GOL_BOARD_HEIGHT % 64) != 0))
+  #error GOL_BOARD_HEIGHT must be no more than 64, or a multiple of 64.
+#endif
+
+#define GOL_HASH_HISTORY   16    // Longest cycle we can notice.
+#define GOL_AGE_PLANES      3    // Enough for LIFE_MAX_STATES.
+
+class StringBuilder;
+
+
+class GoLBoard {
+  public:
+    GoLBoard();
+    ~GoLBoard();
+
+    void clear();
+    void randomize();          // Seeds the whole board, half alive.
+    void step();               // Advance one generation.
+    bool stepSome(uint8_t words);   // Advance that many columns of words. True once the generation is done.
+    inline bool stepping() {   return _stepping;   };
+    bool stable();             // True if the last step changed nothing.
+    inline uint32_t hash() {     return _hash;     };
+    inline uint8_t  period() {   return _period;   };   // Of the cycle we're in. 0 if none seen.
+
+    void redrawAll();
+    // Words of this row the renderer owes, one bit each. Bit k is word k.
+    inline uint32_t dirtyWords(uint16_t r) {
+      uint32_t ret = 0;
+      for (int k = 0; k < GOL_WORDS_PER_ROW; k++) {
+        ret |= ((_redraw[k][r >> 6] >> (r & 0x3F)) & 1) << k;
+      }
+      return ret;
+    };
+    void clearRedraw();
+
+    inline bool alive(uint16_t row, uint16_t col) {
+      return ((_cells[_cur][row][col >> 5] >> (col & 0x1F)) & 1);
+    };
+    inline bool wasAlive(uint16_t row, uint16_t col) {
+      return ((_cells[1 - _cur][row][col >> 5] >> (col & 0x1F)) & 1);
+    };
+    uint32_t span(uint16_t row, uint16_t col, uint8_t n);   // n cells (up to 32) from col, wrapping. Bit 0 is col.
+    void set(uint16_t row, uint16_t col);
+    uint8_t age(uint16_t row, uint16_t col);    // 0 unless the cell is dying. Then its state, less 1.
+    inline uint32_t dying(uint16_t r, uint8_t k) {
+      if (NULL == _age) return 0;
+      return (_age[0][r][k] | _age[1][r][k] | _age[2][r][k]);
+    };
+
+    inline const uint32_t* row(uint16_t r) {        return _cells[_cur][r];       };
+    inline const uint32_t* priorRow(uint16_t r) {   return _cells[1 - _cur][r];   };
+
+    // For engines that jump ahead (HashLife). Fill every row of the other buffer, and
+    //   then commit() it as being some number of generations on from this one.
+    inline uint32_t* nextRow(uint16_t r) {          return _cells[1 - _cur][r];   };
+    void commit(uint32_t gens);
+
+    int8_t setRule(const LifeRule*);   // Ages are reset, and everything is evaluated next step.
+    inline const LifeRule* rule() {   return &_rule;   };
+
+    void printDebug(StringBuilder*);
+
+    uint32_t generation;
+    uint32_t tiles_evaluated;     // Over all generations. Compare with (generation * GOL_TILE_COUNT).
+
+
+  private:
+    uint32_t _cells[2][GOL_BOARD_HEIGHT][GOL_WORDS_PER_ROW];
+    uint32_t (*_age)[GOL_BOARD_HEIGHT][GOL_WORDS_PER_ROW];   // GOL_AGE_PLANES of them. NULL unless the rule has more than two states.
+    uint64_t _changed[GOL_WORDS_PER_ROW][GOL_ROW_BLOCKS];   // Tiles that differ between the two buffers.
+    uint64_t _edge_w[GOL_WORDS_PER_ROW][GOL_ROW_BLOCKS];    // ...and of those, the ones whose lowest cell changed.
+    uint64_t _edge_e[GOL_WORDS_PER_ROW][GOL_ROW_BLOCKS];    // ...and whose highest cell changed.
+    uint64_t _redraw[GOL_WORDS_PER_ROW][GOL_ROW_BLOCKS];    // Tiles that changed since the renderer last looked.
+    uint64_t _eval[GOL_WORDS_PER_ROW][GOL_ROW_BLOCKS];      // Tiles to evaluate in the generation underway.
+    uint32_t _hash;
+    uint32_t _history[GOL_HASH_HISTORY];   // Hashes of the generations before this one.
+    uint8_t  _hist_idx;
+    uint8_t  _hist_depth;      // Generations in the history since it was last forgotten.
+    uint8_t  _period;
+    uint8_t  _cur;
+    uint8_t  _step_k;          // The next column of words to evaluate...
+    bool     _stepping;        // ...if a generation is underway.
+    LifeRule _rule;
+
+    /*
+    * One word's share of the board hash. Any decent integer mix will do, so long as
+    *   the same value in different places hashes differently. This is the finalizer
+    *   from MurmurHash3, over the value and its position.
+    */
+    static inline uint32_t mix(uint32_t idx, uint32_t val) {
+      uint32_t h = val ^ (idx * 0x9E3779B9);
+      h ^= h >> 16;
+      h *= 0x85EBCA6B;
+      h ^= h >> 13;
+      h *= 0xC2B2AE35;
+      h ^= h >> 16;
+      return h;
+    };
+
+    /* A word's share of the board hash, given its cells, over those and its ages. */
+    inline uint32_t term(uint32_t cells, uint16_t r, uint8_t k) {
+      uint32_t idx = (r * GOL_WORDS_PER_ROW) + k;
+      uint32_t ret = mix(idx, cells);
+      if (dying(r, k)) {
+        for (int p = 0; p < GOL_AGE_PLANES; p++) {
+          ret ^= mix(idx + ((p + 1) * GOL_TILE_COUNT), _age[p][r][k]);
+        }
+      }
+      return ret;
+    };
+
+    void rehash();
+    void mark_all_changed();
+    static void spread(const uint64_t* rows, uint64_t* out);
+    template <class R> void step_words(const R&, uint8_t k0, uint8_t k1);
+};
+
+#endif
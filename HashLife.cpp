@@ -0,0 +1,465 @@
+/*
+File:   HashLife.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "HashLife.h"
+#include <stdlib.h>
+#include <string.h>
+#include <StringBuilder.h>
+
+
+HashLife::HashLife() {
+  _pool    = NULL;
+  _buckets = NULL;
+  _marks   = NULL;
+  _used    = 0;
+  _free    = 0;
+  _live    = 0;
+  _full    = false;
+  _root_count = 0;
+  _rule.parse(LIFE_RULE_LIST[0]);
+  result_calls = 0;
+  result_hits  = 0;
+  node_lookups = 0;
+  node_hits    = 0;
+  collections  = 0;
+  collected    = 0;
+  dropped      = 0;
+  peak_roots   = 0;
+  jumps        = 0;
+  failures     = 0;
+}
+
+
+HashLife::~HashLife() {
+  if (_pool)    free(_pool);
+  if (_buckets) free(_buckets);
+  if (_marks)   free(_marks);
+}
+
+
+int8_t HashLife::init() {
+  if (NULL == _pool) {
+    _pool    = (HashLifeNode*) malloc(HASHLIFE_POOL_SIZE * sizeof(HashLifeNode));
+    _buckets = (HashLifeIdx*) malloc(HASHLIFE_POOL_SIZE * sizeof(HashLifeIdx));
+    _marks   = (uint8_t*) malloc((HASHLIFE_POOL_SIZE + 7) >> 3);
+    if ((NULL == _pool) || (NULL == _buckets) || (NULL == _marks)) {
+      if (_pool)    free(_pool);
+      if (_buckets) free(_buckets);
+      if (_marks)   free(_marks);
+      _pool    = NULL;
+      _buckets = NULL;
+      _marks   = NULL;
+      return -1;
+    }
+  }
+  reset();
+  return 0;
+}
+
+
+void HashLife::reset() {
+  memset(_buckets, 0, HASHLIFE_POOL_SIZE * sizeof(HashLifeIdx));
+  memset(&_pool[0], 0, sizeof(HashLifeNode));
+  _used = 1;
+  _free = 0;
+  _live = 0;
+  _full = false;
+  _root_count = 0;
+}
+
+
+static inline uint32_t node_hash(uint8_t level, HashLifeIdx q0, HashLifeIdx q1, HashLifeIdx q2, HashLifeIdx q3) {
+  uint32_t h = ((((((((uint32_t) q0 * 0x9E3779B1) + q1) * 0x9E3779B1) + q2) * 0x9E3779B1) + q3) * 0x85EBCA77) ^ level;
+  return (h ^ (h >> 15)) % HASHLIFE_POOL_SIZE;
+}
+
+
+/*
+* Hash-consing. Returns the one node with this content, making it if need be.
+*/
+HashLifeIdx HashLife::find(uint8_t level, HashLifeIdx q0, HashLifeIdx q1, HashLifeIdx q2, HashLifeIdx q3) {
+  if (_full) return 0;
+  node_lookups++;
+  uint32_t h = node_hash(level, q0, q1, q2, q3);
+  for (HashLifeIdx i = _buckets[h]; i; i = _pool[i].next) {
+    HashLifeNode* n = &_pool[i];
+    if ((n->level == level) && (n->q[0] == q0) && (n->q[1] == q1) && (n->q[2] == q2) && (n->q[3] == q3)) {
+      node_hits++;
+      return i;
+    }
+  }
+  if ((0 == _free) && (_used >= HASHLIFE_POOL_SIZE)) {
+    // The children of the node we're about to make are needed, too. A leaf has none.
+    uint16_t held = _root_count;
+    if (HASHLIFE_LEAF_LEVEL != level) {
+      hold(q0);
+      hold(q1);
+      hold(q2);
+      hold(q3);
+    }
+    bool freed = !_full && collect();
+    _root_count = held;
+    if (!freed) {
+      _full = true;
+      return 0;
+    }
+  }
+  HashLifeIdx i = _free;
+  if (i) {
+    _free = _pool[i].next;
+  }
+  else {
+    i = _used++;
+  }
+  _live++;
+  HashLifeNode* n = &_pool[i];
+  n->q[0]   = q0;
+  n->q[1]   = q1;
+  n->q[2]   = q2;
+  n->q[3]   = q3;
+  n->level  = level;
+  n->result = 0;
+  n->step   = 0;
+  n->next   = _buckets[h];
+  _buckets[h] = i;
+  return i;
+}
+
+
+/*
+* Marks a node, and everything it reaches by its children, and by its result unless
+*   results are being let go. Both are a level down, so this goes no deeper than
+*   the node's level.
+*/
+void HashLife::mark(HashLifeIdx idx, bool results) {
+  while (idx && !(_marks[idx >> 3] & (1 << (idx & 7)))) {
+    _marks[idx >> 3] |= (1 << (idx & 7));
+    const HashLifeNode* n = &_pool[idx];
+    if (HASHLIFE_LEAF_LEVEL == n->level) return;   // q[] is cells.
+    for (int i = 0; i < 4; i++) mark(n->q[i], results);
+    idx = results ? n->result : 0;
+  }
+}
+
+
+/*
+* Everything the held nodes don't reach goes on the free list, and the hash table is
+*   made again from what's left. At first, the results of what's kept are kept with
+*   it. If that doesn't free enough, those results are let go as well, and only the
+*   squares themselves are kept. Returns false if even that freed too little to go
+*   on with.
+*/
+bool HashLife::collect() {
+  collections++;
+  if (_root_count > peak_roots) peak_roots = _root_count;
+  uint32_t freed = 0;
+  for (uint8_t pass = 0; pass < 2; pass++) {
+    bool results = (0 == pass);
+    memset(_marks, 0, (HASHLIFE_POOL_SIZE + 7) >> 3);
+    for (uint16_t i = 0; i < _root_count; i++) mark(_roots[i], results);
+
+    memset(_buckets, 0, HASHLIFE_POOL_SIZE * sizeof(HashLifeIdx));
+    _free = 0;
+    for (uint32_t i = _used - 1; i > 0; i--) {
+      HashLifeNode* n = &_pool[i];
+      if (_marks[i >> 3] & (1 << (i & 7))) {
+        uint32_t h = node_hash(n->level, n->q[0], n->q[1], n->q[2], n->q[3]);
+        n->next = _buckets[h];
+        _buckets[h] = i;
+        if (n->result && !(_marks[n->result >> 3] & (1 << (n->result & 7)))) {
+          n->result = 0;   // Let go.
+          dropped++;
+        }
+      }
+      else {
+        if (n->level) freed++;
+        n->level = 0;
+        n->next  = _free;
+        _free    = i;
+      }
+    }
+    if (freed >= (HASHLIFE_POOL_SIZE >> HASHLIFE_MIN_FREE_SHIFT)) break;
+  }
+  _live     -= freed;
+  collected += freed;
+  return (freed >= (HASHLIFE_POOL_SIZE >> HASHLIFE_MIN_FREE_SHIFT));
+}
+
+
+HashLifeIdx HashLife::leaf(uint64_t c) {
+  return find(HASHLIFE_LEAF_LEVEL, (uint16_t) c, (uint16_t) (c >> 16), (uint16_t) (c >> 32), (uint16_t) (c >> 48));
+}
+
+
+uint64_t HashLife::cells(HashLifeIdx idx) {
+  const HashLifeIdx* q = _pool[idx].q;
+  return ((uint64_t) q[0] | ((uint64_t) q[1] << 16) | ((uint64_t) q[2] << 32) | ((uint64_t) q[3] << 48));
+}
+
+
+/*
+* The node's center, one level down.
+*/
+HashLifeIdx HashLife::center(HashLifeIdx idx) {
+  const HashLifeIdx* q = _pool[idx].q;
+  if ((HASHLIFE_LEAF_LEVEL + 1) == _pool[idx].level) {
+    // Children are leaves. Take the inner 4x4 corner of each.
+    uint64_t nw = cells(q[0]);
+    uint64_t ne = cells(q[1]);
+    uint64_t sw = cells(q[2]);
+    uint64_t se = cells(q[3]);
+    uint64_t c  = 0;
+    for (int y = 0; y < 4; y++) {
+      uint64_t top = ((nw >> (((y + 4) << 3) + 4)) & 0x0F) | (((ne >> ((y + 4) << 3)) & 0x0F) << 4);
+      uint64_t bot = ((sw >> ((y << 3) + 4)) & 0x0F) | (((se >> (y << 3)) & 0x0F) << 4);
+      c |= (top << (y << 3)) | (bot << ((y + 4) << 3));
+    }
+    return leaf(c);
+  }
+  return join(_pool[q[0]].q[3], _pool[q[1]].q[2], _pool[q[2]].q[1], _pool[q[3]].q[0]);
+}
+
+
+/* The node straddling two that sit side by side. */
+HashLifeIdx HashLife::horizontal(HashLifeIdx w, HashLifeIdx e) {
+  return join(_pool[w].q[1], _pool[e].q[0], _pool[w].q[3], _pool[e].q[2]);
+}
+
+
+/* The node straddling two that sit one above the other. */
+HashLifeIdx HashLife::vertical(HashLifeIdx n, HashLifeIdx s) {
+  return join(_pool[n].q[2], _pool[n].q[3], _pool[s].q[0], _pool[s].q[1]);
+}
+
+
+/*
+* A 16x16 node is run directly, with the same bit-sliced counting as GoLBoard. Junk
+*   from beyond the edges creeps in by one cell per generation, and after four
+*   generations has yet to reach the center.
+*/
+HashLifeIdx HashLife::base_result(HashLifeIdx idx, uint8_t step) {
+  const HashLifeIdx* q = _pool[idx].q;
+  uint64_t nw = cells(q[0]);
+  uint64_t ne = cells(q[1]);
+  uint64_t sw = cells(q[2]);
+  uint64_t se = cells(q[3]);
+  uint32_t rows[16];
+  uint32_t nu[16];
+  for (int y = 0; y < 8; y++) {
+    rows[y]     = ((nw >> (y << 3)) & 0xFF) | (((ne >> (y << 3)) & 0xFF) << 8);
+    rows[y + 8] = ((sw >> (y << 3)) & 0xFF) | (((se >> (y << 3)) & 0xFF) << 8);
+  }
+
+  for (uint8_t g = 0; g < (1 << step); g++) {
+    nu[0]  = rows[0];
+    nu[15] = rows[15];
+    for (int y = 1; y < 15; y++) {
+      uint32_t c[4];
+      uint32_t lo[4];
+      uint32_t hi[3];
+      if (LIFE_NEIGHBORS_VN == _rule.neighborhood) {
+        life_count_vn(rows[y - 1], rows[y + 1], rows[y] << 1, rows[y] >> 1, c);
+      }
+      else {
+        life_count_moore(rows[y - 1] << 1, rows[y - 1], rows[y - 1] >> 1,
+                         rows[y] << 1, rows[y] >> 1,
+                         rows[y + 1] << 1, rows[y + 1], rows[y + 1] >> 1, c);
+      }
+      life_decode(c, lo, hi);
+      nu[y] = ((rows[y] & life_select(&_rule.s_terms, lo, hi)) | (~rows[y] & life_select(&_rule.b_terms, lo, hi))) & 0xFFFF;
+    }
+    memcpy(rows, nu, sizeof(rows));
+  }
+
+  uint64_t c = 0;
+  for (int y = 0; y < 8; y++) {
+    c |= (uint64_t) ((rows[y + 4] >> 4) & 0xFF) << (y << 3);
+  }
+  return leaf(c);
+}
+
+
+/*
+* The center of the node, 2^step generations on. step can be no more than the
+*   node's level less 2.
+* The node is cut into nine overlapping squares a level down. Those are advanced
+*   (or just trimmed, if this isn't a full-size step) to their centers, which
+*   are put together into four squares, and advanced again.
+* The node and every square made on the way are held until the result is known, so
+*   that a collection can't take them.
+*/
+HashLifeIdx HashLife::result(HashLifeIdx idx, uint8_t step) {
+  result_calls++;
+  if (_pool[idx].result && (_pool[idx].step == step)) {
+    result_hits++;
+    return _pool[idx].result;
+  }
+  uint16_t held  = _root_count;
+  uint8_t  level = _pool[idx].level;
+  HashLifeIdx ret = 0;
+  hold(idx);
+  if ((HASHLIFE_LEAF_LEVEL + 1) == level) {
+    ret = base_result(idx, step);
+  }
+  else {
+    const HashLifeIdx a = _pool[idx].q[0];
+    const HashLifeIdx b = _pool[idx].q[1];
+    const HashLifeIdx c = _pool[idx].q[2];
+    const HashLifeIdx d = _pool[idx].q[3];
+    HashLifeIdx n[9];
+    n[0] = a;
+    n[1] = hold(horizontal(a, b));
+    n[2] = b;
+    n[3] = hold(vertical(a, c));
+    n[4] = hold(center(idx));
+    n[5] = hold(vertical(b, d));
+    n[6] = c;
+    n[7] = hold(horizontal(c, d));
+    n[8] = d;
+
+    bool    full_step = ((level - 2) == step);
+    uint8_t inner     = full_step ? (level - 3) : step;
+    HashLifeIdx r[9];
+    for (int i = 0; (i < 9) && !_full; i++) {
+      r[i] = hold(full_step ? result(n[i], level - 3) : center(n[i]));
+    }
+    if (!_full) {
+      HashLifeIdx nw = hold(result(join(r[0], r[1], r[3], r[4]), inner));
+      HashLifeIdx ne = hold(result(join(r[1], r[2], r[4], r[5]), inner));
+      HashLifeIdx sw = hold(result(join(r[3], r[4], r[6], r[7]), inner));
+      HashLifeIdx se = hold(result(join(r[4], r[5], r[7], r[8]), inner));
+      ret = join(nw, ne, sw, se);
+    }
+  }
+  if (_root_count > peak_roots) peak_roots = _root_count;
+  _root_count = held;
+  if (_full) return 0;
+  _pool[idx].result = ret;
+  _pool[idx].step   = step;
+  return ret;
+}
+
+
+HashLifeIdx HashLife::build(GoLBoard* board, uint16_t row, uint16_t col, uint8_t level) {
+  if (HASHLIFE_LEAF_LEVEL == level) {
+    uint64_t c = 0;
+    for (int y = 0; y < 8; y++) {
+      c |= (uint64_t) ((board->row(row + y)[col >> 5] >> (col & 0x1F)) & 0xFF) << (y << 3);
+    }
+    return leaf(c);
+  }
+  uint16_t    held = _root_count;
+  uint16_t    half = 1 << (level - 1);
+  HashLifeIdx nw = hold(build(board, row,        col,        level - 1));
+  HashLifeIdx ne = hold(build(board, row,        col + half, level - 1));
+  HashLifeIdx sw = hold(build(board, row + half, col,        level - 1));
+  HashLifeIdx se = hold(build(board, row + half, col + half, level - 1));
+  HashLifeIdx ret = join(nw, ne, sw, se);
+  _root_count = held;
+  return ret;
+}
+
+
+void HashLife::unbuild(GoLBoard* board, HashLifeIdx idx, uint16_t row, uint16_t col) {
+  if (HASHLIFE_LEAF_LEVEL == _pool[idx].level) {
+    uint64_t c = cells(idx);
+    for (int y = 0; y < 8; y++) {
+      uint32_t* word = &board->nextRow(row + y)[col >> 5];
+      *word = (*word & ~((uint32_t) 0xFF << (col & 0x1F))) | ((uint32_t) ((c >> (y << 3)) & 0xFF) << (col & 0x1F));
+    }
+    return;
+  }
+  uint16_t half = 1 << (_pool[idx].level - 1);
+  unbuild(board, _pool[idx].q[0], row,        col);
+  unbuild(board, _pool[idx].q[1], row,        col + half);
+  unbuild(board, _pool[idx].q[2], row + half, col);
+  unbuild(board, _pool[idx].q[3], row + half, col + half);
+}
+
+
+/*
+* The board is tiled into a node big enough that the center we get back is a whole
+*   number of copies of the board. Its corner is then the board, advanced.
+*/
+int8_t HashLife::try_jump(GoLBoard* board, uint8_t log2_gens) {
+  uint8_t board_level = 0;
+  while ((1 << board_level) < GOL_BOARD_WIDTH) board_level++;
+  uint8_t top = ((log2_gens + 2) > (board_level + 2)) ? (log2_gens + 2) : (board_level + 2);
+
+  HashLifeIdx node = hold(build(board, 0, 0, board_level));
+  while (!_full && (_pool[node].level < top)) {
+    node = hold(join(node, node, node, node));
+  }
+  if (!_full) node = result(node, log2_gens);
+  if (_full) return -2;
+  while (_pool[node].level > board_level) node = _pool[node].q[0];
+  unbuild(board, node, 0, 0);
+  board->commit((uint32_t) 1 << log2_gens);
+  return 0;
+}
+
+
+/*
+* Advances the board by 2^log2_gens generations.
+* Returns...
+*   -1 if HashLife can't run this board or rule.
+*   -2 if the pool was too small. The board is untouched.
+* What the jump left in the pool is kept, either way. Every result in it is good, and
+*   the next jump may want them. The next collection takes whatever it doesn't.
+*/
+int8_t HashLife::jump(GoLBoard* board, uint8_t log2_gens) {
+  if ((GOL_BOARD_WIDTH != GOL_BOARD_HEIGHT) || (GOL_BOARD_WIDTH & (GOL_BOARD_WIDTH - 1))) return -1;
+  if ((NULL == _pool) || (log2_gens > HASHLIFE_MAX_JUMP)) return -1;
+  const LifeRule* rule = board->rule();
+  if (rule->states > 2) return -1;
+  if ((rule->birth != _rule.birth) || (rule->survive != _rule.survive) || (rule->neighborhood != _rule.neighborhood)) {
+    // Every result we know is for the old rule.
+    _rule = *rule;
+    reset();
+  }
+
+  int8_t ret = try_jump(board, log2_gens);
+  _root_count = 0;
+  _full       = false;
+  if (ret) {
+    failures++;
+  }
+  else {
+    jumps++;
+  }
+  return ret;
+}
+
+
+void HashLife::printDebug(StringBuilder* output) {
+  output->concat("\n-- HashLife\n");
+  if (NULL == _pool) {
+    output->concat("\tNot allocated.\n");
+    return;
+  }
+  output->concatf("\tNodes:         %u of %u (%u bytes)\n", _live, HASHLIFE_POOL_SIZE - 1,
+    HASHLIFE_POOL_SIZE * (sizeof(HashLifeNode) + sizeof(HashLifeIdx)) + ((HASHLIFE_POOL_SIZE + 7) >> 3));
+  output->concatf("\tResult hits:   %u of %u (%u%%)\n", result_hits, result_calls, result_calls ? (uint32_t) (((uint64_t) result_hits * 100) / result_calls) : 0);
+  output->concatf("\tNode hits:     %u of %u (%u%%)\n", node_hits, node_lookups, node_lookups ? (uint32_t) (((uint64_t) node_hits * 100) / node_lookups) : 0);
+  output->concatf("\tCollections:   %u (%u nodes made over, %u results let go, at most %u held)\n", collections, collected, dropped, peak_roots);
+  output->concatf("\tJumps:         %u (%u failed)\n", jumps, failures);
+}
@@ -0,0 +1,159 @@
+/*
+File:   HashLife.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+HashLife, for jumping a GoLBoard ahead by thousands of generations at once.
+
+The board is held as a quadtree. A node at level L is a square of (1 << L) cells
+  on a side, made of four nodes at level L-1. Nodes are hash-consed, so any square
+  that shows up more than once (empty space, still-lifes, the same blinker in
+  many places) is only stored once. Leaves are 8x8 squares, at level 3.
+
+Each node remembers its result: its center half, some power of two generations
+  on. Results are found from the results of the node's children, and since
+  identical squares are the same node, work done for one is done for all of them.
+  A settled board is mostly a few kinds of square repeated, and jumps ahead for
+  very little.
+
+HashLife works on an infinite plane, and the board is a torus. A board tiled
+  without end in every direction evolves the same as the torus, and a node made
+  of copies of the board is such a tiling, for as far as light can travel in the
+  time it's advanced. So the board is tiled into a large enough node, and the
+  result is unwrapped back onto it.
+
+Nodes come from a fixed pool, allocated once. When it fills, the nodes that the
+  jump can no longer reach are collected, and made over into new ones. What it can
+  still reach is the board's own tree, the squares it is partway through, and the
+  results those already have. So a jump needs only as many nodes as it holds at
+  once, not as many as it ever makes. Results for squares that were collected are
+  forgotten, and worked out again if the squares come back. If a collection frees
+  too little to go on with, the jump fails, and the caller should keep stepping the
+  board instead. host/hashlife_bench.cpp measures it against the plain stepper, at
+  the jump the sketch asks for, on the pool the sketch has.
+
+Only two-state rules are handled. The board must be a square whose side is a power
+  of two.
+*/
+
+
+#ifndef __MURUMLUX_HASHLIFE_H__
+#define __MURUMLUX_HASHLIFE_H__
+
+#include <inttypes.h>
+#include "GoLBoard.h"
+#include "LifeRule.h"
+
+#ifndef HASHLIFE_POOL_SIZE
+  #define HASHLIFE_POOL_SIZE  8192    // Nodes. 16 bytes each, plus 2 for the hash table.
+#endif
+
+// A node index is only as wide as the pool needs.
+#if (HASHLIFE_POOL_SIZE > 65535)
+  typedef uint32_t HashLifeIdx;
+#else
+  typedef uint16_t HashLifeIdx;
+#endif
+
+#define HASHLIFE_LEAF_LEVEL   3
+#define HASHLIFE_MAX_JUMP    15    // log2 of the most generations in one jump.
+#define HASHLIFE_MAX_ROOTS  512    // Nodes a jump may hold at once, down its whole depth.
+#define HASHLIFE_MIN_FREE_SHIFT  4 // A collection must free 1/16th of the pool, or the jump fails.
+
+class StringBuilder;
+
+
+/*
+* A node. Index 0 means none. Leaves keep their 64 cells in q[], 16 to an entry, a
+*   row of 8 cells per byte, row 0 first. Otherwise q[] is the nw, ne, sw and se
+*   children. A collected node has level 0, and is on the free list by next.
+*/
+typedef struct hashlife_node_t {
+  HashLifeIdx q[4];
+  HashLifeIdx result;    // Memoized center, 2^step generations on. 0 if not yet known.
+  HashLifeIdx next;      // Next node in the same hash bucket.
+  uint8_t     level;
+  uint8_t     step;
+} HashLifeNode;
+
+
+class HashLife {
+  public:
+    HashLife();
+    ~HashLife();
+
+    int8_t init();                  // Allocates the pool. 0 on success.
+    inline bool ready() {   return (NULL != _pool);   };
+    int8_t jump(GoLBoard*, uint8_t log2_gens);
+    void   reset();                 // Forget every node.
+
+    void printDebug(StringBuilder*);
+
+    /* Stats, since init(). */
+    uint32_t result_calls;     // Results asked for...
+    uint32_t result_hits;      // ...and the ones that were already known.
+    uint32_t node_lookups;     // Nodes asked for...
+    uint32_t node_hits;        // ...and the ones that already existed.
+    uint32_t collections;      // Times the pool filled up...
+    uint32_t collected;        // ...the nodes made over because of it...
+    uint32_t dropped;          // ...and the results let go to make room.
+    uint32_t peak_roots;       // The most nodes a jump has held at once.
+    uint32_t jumps;
+    uint32_t failures;         // Jumps that couldn't be done.
+
+
+  private:
+    HashLifeNode* _pool;
+    HashLifeIdx*  _buckets;
+    uint8_t*      _marks;      // A bit per node, for collecting.
+    uint32_t      _used;       // Nodes ever handed out, counting the unused node 0...
+    HashLifeIdx   _free;       // ...the first of those since collected...
+    uint32_t      _live;       // ...and how many of them are in use.
+    bool          _full;       // Set when a node couldn't be made. Results are garbage after.
+    LifeRule      _rule;
+    HashLifeIdx   _roots[HASHLIFE_MAX_ROOTS];   // What the jump is holding, that nothing else reaches.
+    uint16_t      _root_count;
+
+    HashLifeIdx find(uint8_t level, HashLifeIdx q0, HashLifeIdx q1, HashLifeIdx q2, HashLifeIdx q3);
+    HashLifeIdx leaf(uint64_t cells);
+    uint64_t    cells(HashLifeIdx leaf_idx);
+    inline HashLifeIdx join(HashLifeIdx nw, HashLifeIdx ne, HashLifeIdx sw, HashLifeIdx se) {
+      return find(_pool[nw].level + 1, nw, ne, sw, se);
+    };
+    HashLifeIdx center(HashLifeIdx);
+    HashLifeIdx horizontal(HashLifeIdx w, HashLifeIdx e);
+    HashLifeIdx vertical(HashLifeIdx n, HashLifeIdx s);
+    HashLifeIdx base_result(HashLifeIdx, uint8_t step);
+    HashLifeIdx result(HashLifeIdx, uint8_t step);
+
+    // Anything held across a call that might make a node has to be held here.
+    inline HashLifeIdx hold(HashLifeIdx idx) {
+      if (_root_count < HASHLIFE_MAX_ROOTS) _roots[_root_count++] = idx;
+      else _full = true;
+      return idx;
+    };
+    void mark(HashLifeIdx, bool results);
+    bool collect();
+
+    HashLifeIdx build(GoLBoard*, uint16_t row, uint16_t col, uint8_t level);
+    void        unbuild(GoLBoard*, HashLifeIdx node, uint16_t row, uint16_t col);
+    int8_t      try_jump(GoLBoard*, uint8_t log2_gens);
+};
+
+#endif
@@ -0,0 +1,137 @@
+/*
+File:   LifeRule.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "LifeRule.h"
+#include <stdlib.h>
+#include <StringBuilder.h>
+
+
+const char* const LIFE_RULE_LIST[] = {
+  "B3/S23",          // Conway's Life
+  "B3/S23V",         // The same, over the Von Neumann neighborhood. The old 'v' option.
+  "B36/S23",         // HighLife
+  "B3678/S34678",    // Day & Night
+  "B2/S",            // Seeds
+  "B2/S/C3",         // Brian's Brain
+  "B2/S345/C4",      // Star Wars
+  "B3/S12345"        // Maze
+};
+
+const uint8_t LIFE_RULE_COUNT = sizeof(LIFE_RULE_LIST) / sizeof(LIFE_RULE_LIST[0]);
+
+
+static void compile_set(uint16_t set, LifeTerms* terms) {
+  terms->groups = 0;
+  for (uint8_t n = 0; n < 12; n++) {
+    bool in_set = (n <= 8) && (set & (1 << n));
+    terms->sel[n >> 2][n & 3] = in_set ? 0xFFFFFFFF : 0;
+    if (in_set) terms->groups |= (1 << (n >> 2));
+  }
+}
+
+
+void LifeRule::compile() {
+  compile_set(birth,   &b_terms);
+  compile_set(survive, &s_terms);
+}
+
+
+/*
+* Reads a digit run into a count set. Returns the first character it didn't eat.
+*/
+static const char* parse_counts(const char* str, uint16_t* set) {
+  *set = 0;
+  while ((*str >= '0') && (*str <= '8')) {
+    *set |= (1 << (*str - '0'));
+    str++;
+  }
+  return str;
+}
+
+
+int8_t LifeRule::parse(const char* str) {
+  uint16_t b = 0;
+  uint16_t s = 0;
+  uint8_t  c = 2;
+  char     n = LIFE_NEIGHBORS_MOORE;
+  if (NULL == str) return -1;
+
+  if (('B' == *str) || ('b' == *str)) {
+    // B.../S...[/C...]
+    str = parse_counts(str + 1, &b);
+    if ('/' != *str++) return -1;
+    if (('S' != *str) && ('s' != *str)) return -1;
+    str = parse_counts(str + 1, &s);
+    if ('/' == *str) {
+      str++;
+      if (('C' == *str) || ('c' == *str)) str++;
+      c = 0;
+      while ((*str >= '0') && (*str <= '9')) c = (c * 10) + (*str++ - '0');
+    }
+  }
+  else {
+    // S/B[/C]
+    str = parse_counts(str, &s);
+    if ('/' != *str++) return -1;
+    str = parse_counts(str, &b);
+    if ('/' == *str) {
+      str++;
+      c = 0;
+      while ((*str >= '0') && (*str <= '9')) c = (c * 10) + (*str++ - '0');
+    }
+  }
+
+  if (('V' == *str) || ('v' == *str)) {
+    n = LIFE_NEIGHBORS_VN;
+    str++;
+  }
+  if ('\0' != *str) return -1;
+  if ((c < 2) || (c > LIFE_MAX_STATES)) return -2;
+  if (b & 1) return -3;   // B0 would need the whole empty board to flash. Not supported.
+  if ((LIFE_NEIGHBORS_VN == n) && ((b | s) & 0x1E0)) return -4;   // Counts past 4 are impossible.
+
+  birth        = b;
+  survive      = s;
+  states       = c;
+  neighborhood = n;
+  compile();
+  return 0;
+}
+
+
+bool LifeRule::isConway() {
+  return ((0x0008 == birth) && (0x000C == survive) && (2 == states) && (LIFE_NEIGHBORS_MOORE == neighborhood));
+}
+
+
+void LifeRule::printRule(StringBuilder* output) {
+  output->concat("B");
+  for (uint8_t n = 0; n <= 8; n++) {
+    if (birth & (1 << n)) output->concatf("%u", n);
+  }
+  output->concat("/S");
+  for (uint8_t n = 0; n <= 8; n++) {
+    if (survive & (1 << n)) output->concatf("%u", n);
+  }
+  if (states > 2) output->concatf("/C%u", states);
+  if (LIFE_NEIGHBORS_VN == neighborhood) output->concat("V");
+}
@@ -0,0 +1,173 @@
+/*
+File:   LifeRule.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+Life-like cellular automata rules, for GoLBoard.
+
+A rule is the set of neighbor counts that give birth to a dead cell, the set that
+  lets a live cell survive, the number of states a cell can be in, and the shape of
+  the neighborhood.
+
+Rules with more than two states are "Generations" rules. State 1 is alive. A live
+  cell that fails to survive doesn't die outright, but goes through states 2, 3...
+  until it wraps around to 0. Only live cells count as neighbors, and a cell can't
+  be born until it has finished dying.
+
+Rulestrings are read in the usual forms:
+  B3/S23        Birth/survival. Conway's Life.
+  23/3          Survival/birth, the older notation for the same thing.
+  B2/S/C3       Generations, with the state count. Brian's Brain.
+  /2/3          Survival/birth/states. Also Brian's Brain.
+A trailing 'V' selects the Von Neumann neighborhood (N, S, E, W). Otherwise it is
+  Moore (all eight).
+
+compile() turns the count sets into masks for GoLBoard's bit-sliced kernel, which
+  decodes the four bits of each cell's neighbor count once and then selects from
+  them without branching on the rule. Any rule costs about what Conway's does.
+*/
+
+
+#ifndef __MURUMLUX_LIFE_RULE_H__
+#define __MURUMLUX_LIFE_RULE_H__
+
+#include <inttypes.h>
+
+#define LIFE_MAX_STATES         8      // GoLBoard keeps three bits of dying age.
+
+#define LIFE_NEIGHBORS_MOORE    'M'
+#define LIFE_NEIGHBORS_VN       'V'
+
+class StringBuilder;
+
+
+/*
+* A count set, split on the top two bits of the count. For each of the three
+*   possible values of those (0-3, 4-7, 8), sel holds an all-ones mask for each
+*   value of the bottom two bits that is in the set. groups has a bit set for every
+*   part that has anything in it, so empty parts cost nothing.
+*/
+typedef struct life_terms_t {
+  uint32_t sel[3][4];
+  uint8_t  groups;
+} LifeTerms;
+
+
+class LifeRule {
+  public:
+    uint16_t birth;           // Bit n set means a dead cell with n neighbors is born.
+    uint16_t survive;         // Bit n set means a live cell with n neighbors lives on.
+    uint8_t  states;          // 2 for ordinary Life-like rules.
+    char     neighborhood;    // LIFE_NEIGHBORS_MOORE or LIFE_NEIGHBORS_VN.
+
+    /* Filled by compile(). */
+    LifeTerms b_terms;
+    LifeTerms s_terms;
+
+    int8_t parse(const char*);   // 0 on success. Compiles on success.
+    void   compile();
+    void   printRule(StringBuilder*);
+    bool   isConway();
+};
+
+
+/*
+* Bit-sliced neighbor counting, shared by the engines. Every argument is a word of
+*   cells, already shifted to line up with the cells being counted. The count comes
+*   out as four bit-planes (ones, twos, fours, eights).
+*
+* Moore: each row contributes a sum of three (two for our own row, which skips the
+*   cell itself), held as two bit-planes. Those are added with full adders until we
+*   have the four bits of the count.
+*/
+static inline void life_count_moore(uint32_t a_w, uint32_t a_c, uint32_t a_e,
+                                    uint32_t h_w, uint32_t h_e,
+                                    uint32_t b_w, uint32_t b_c, uint32_t b_e, uint32_t c[4]) {
+  uint32_t lo_a = a_w ^ a_c ^ a_e;
+  uint32_t hi_a = (a_w & a_c) | (a_e & (a_w ^ a_c));
+  uint32_t lo_b = b_w ^ b_c ^ b_e;
+  uint32_t hi_b = (b_w & b_c) | (b_e & (b_w ^ b_c));
+  uint32_t lo_h = h_w ^ h_e;
+  uint32_t hi_h = h_w & h_e;
+
+  // Ones column, and its carry.
+  uint32_t l0 = lo_a ^ lo_h ^ lo_b;
+  uint32_t l1 = (lo_a & lo_h) | (lo_b & (lo_a ^ lo_h));
+  // Twos column, and its carry.
+  uint32_t h0 = hi_a ^ hi_h ^ hi_b;
+  uint32_t h1 = (hi_a & hi_h) | (hi_b & (hi_a ^ hi_h));
+  uint32_t t0 = l1 ^ h0;
+  uint32_t t1 = l1 & h0;
+
+  c[0] = l0;
+  c[1] = t0;
+  c[2] = h1 ^ t1;
+  c[3] = h1 & t1;
+}
+
+/*
+* Von Neumann (N, S, E, W).
+*/
+static inline void life_count_vn(uint32_t n, uint32_t s, uint32_t w, uint32_t e, uint32_t c[4]) {
+  uint32_t ns_lo = n ^ s;
+  uint32_t ns_hi = n & s;
+  uint32_t we_lo = w ^ e;
+  uint32_t we_hi = w & e;
+
+  uint32_t carry = ns_lo & we_lo;
+  c[0] = ns_lo ^ we_lo;
+  c[1] = ns_hi ^ we_hi ^ carry;
+  c[2] = (ns_hi & we_hi) | (carry & (ns_hi ^ we_hi));
+  c[3] = 0;
+}
+
+/*
+* Decodes the bottom and top two bits of a count, for selecting from.
+*/
+static inline void life_decode(const uint32_t c[4], uint32_t lo[4], uint32_t hi[3]) {
+  lo[0] = ~c[1] & ~c[0];
+  lo[1] = ~c[1] &  c[0];
+  lo[2] =  c[1] & ~c[0];
+  lo[3] =  c[1] &  c[0];
+  hi[0] = ~c[3] & ~c[2];
+  hi[1] = ~c[3] &  c[2];
+  hi[2] =  c[3];
+}
+
+/*
+* The cells whose count is in the set.
+*/
+static inline uint32_t life_select(const LifeTerms* t, const uint32_t lo[4], const uint32_t hi[3]) {
+  uint32_t ret = 0;
+  for (uint8_t g = 0; g < 3; g++) {
+    if (t->groups & (1 << g)) {
+      ret |= hi[g] & ((t->sel[g][0] & lo[0]) | (t->sel[g][1] & lo[1]) | (t->sel[g][2] & lo[2]) | (t->sel[g][3] & lo[3]));
+    }
+  }
+  return ret;
+}
+
+
+/*
+* Built-in rules, as rulestrings. These go through parse() like anything else.
+*/
+extern const char* const LIFE_RULE_LIST[];
+extern const uint8_t     LIFE_RULE_COUNT;
+
+#endif
@@ -0,0 +1,85 @@
+/*
+File:   LineRing.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "LineRing.h"
+#include <string.h>
+#include <StringBuilder.h>
+
+
+LineRing::LineRing() {
+  lines     = 0;
+  dropped   = 0;
+  discarded = 0;
+  reset();
+}
+
+
+void LineRing::reset() {
+  _head     = 0;
+  _tail     = 0;
+  _scan     = 0;
+  _line_len = 0;
+  _dropping = false;
+}
+
+
+/*
+* Looks for a newline among the bytes we haven't looked at yet. A carriage return
+*   before it is left off the line.
+*/
+bool LineRing::nextLine(const char** line, uint16_t* len) {
+  const uint16_t mask = LINE_RING_SIZE - 1;
+  uint16_t head = _head;
+
+  while (_scan != head) {
+    if ('\n' != _buf[_scan & mask]) {
+      _scan++;
+      continue;
+    }
+    char*    str = &_buf[_tail & mask];   // Runs on into the mirror, if it has to.
+    uint16_t n   = _scan - _tail;
+    _scan++;
+    _tail = _scan;
+    if ((n > 0) && (NULL != memchr(str, LINE_RING_BAD_LINE, n))) {
+      discarded++;
+      continue;
+    }
+
+    if ((n > 0) && ('\r' == str[n - 1])) n--;
+    str[n] = '\0';
+    *line  = str;
+    *len   = n;
+    lines++;
+    return true;
+  }
+  return false;
+}
+
+
+void LineRing::printDebug(StringBuilder* output) {
+  output->concat("\n-- LineRing\n");
+  output->concatf("\tLines:         %u\n", lines);
+  output->concatf("\tPending:       %u of %u bytes\n", pending(), LINE_RING_SIZE - 1);
+  output->concatf("\tLongest line:  %u bytes\n", LINE_RING_MAX_LINE);
+  output->concatf("\tDropped:       %u bytes\n", dropped);
+  output->concatf("\tDiscarded:     %u lines (too long, or lost bytes)\n", discarded);
+}
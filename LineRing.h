@@ -0,0 +1,130 @@
+/*
+File:   LineRing.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+Assembles lines of text from a byte stream (the e-field box's link) without
+  touching the heap.
+
+Bytes go into a fixed ring. Each one is written twice: once at its place in the
+  ring, and once at the same place in a mirror that follows it in memory. So any
+  run of bytes in the ring, even one that wraps around the end, can also be read
+  straight through as a single run starting from its first byte. A complete line
+  is handed out as a pointer into the buffer and a length, with no copying. Its
+  newline is overwritten with a NUL, so it can be read as a C string too.
+
+push() and nextLine() only touch their own end of the ring, so push() can be fed
+  from an ISR while the main loop reads lines. The line handed out is only good
+  until the next nextLine(), and the caller should be done with it before the ring
+  can come back around to it.
+
+A line that is too long, or that loses a byte because the ring was full, is
+  thrown away whole: push() marks what it already has of the line as bad and drops
+  everything up to the newline, and nextLine() skips the line when it gets to it.
+  So a reader that falls behind loses lines, but never gets one with a hole in it.
+  Both kinds of loss are counted.
+*/
+
+
+#ifndef __MURUMLUX_LINE_RING_H__
+#define __MURUMLUX_LINE_RING_H__
+
+#include <inttypes.h>
+#include <stdlib.h>
+
+#ifndef LINE_RING_SIZE
+  #define LINE_RING_SIZE   256     // Must be a power of two.
+#endif
+
+#define LINE_RING_MAX_LINE   (LINE_RING_SIZE - 2)   // Not counting the newline.
+#define LINE_RING_BAD_LINE   0x18                   // ASCII CAN. Marks a line that lost bytes.
+
+#if ((LINE_RING_SIZE & (LINE_RING_SIZE - 1)) != 0)
+  #error LINE_RING_SIZE must be a power of two.
+#endif
+
+class StringBuilder;
+
+
+class LineRing {
+  public:
+    LineRing();
+
+    void reset();
+
+    // Returns false if the byte had to be dropped.
+    inline bool push(uint8_t c) {
+      uint16_t h = _head;
+      bool room = ((uint16_t) (h - _tail) < (LINE_RING_SIZE - 1));
+      if (_dropping) {
+        // Nothing more of this line is kept. Only its newline, to close what we have of it.
+        if ('\n' == c) {
+          if (0 == _line_len) {
+            _dropping = false;   // There was none of it. Nothing to close.
+          }
+          else if (room) {
+            _dropping = false;
+            return _store(h, c);
+          }
+        }
+      }
+      else if (room && (('\n' == c) || (_line_len < LINE_RING_MAX_LINE))) {
+        return _store(h, c);
+      }
+      else {
+        // We lose this byte, so we lose the line. Mark what we have of it as bad.
+        _dropping = (0 != _line_len) || ('\n' != c);
+        if (_line_len) _mirror(h - 1, LINE_RING_BAD_LINE);
+      }
+      dropped++;
+      return false;
+    };
+
+    bool nextLine(const char** line, uint16_t* len);   // True if there was a complete line.
+    inline uint16_t pending() {   return (uint16_t) (_head - _tail);   };
+
+    void printDebug(StringBuilder*);
+
+    uint32_t lines;
+    uint32_t dropped;       // Bytes not kept, because we were full or the line was being thrown away.
+    uint32_t discarded;     // Lines thrown away because they lost bytes, or were too long.
+
+
+  private:
+    char              _buf[LINE_RING_SIZE * 2];
+    volatile uint16_t _head;     // Free-running. Only push() moves this...
+    volatile uint16_t _tail;     // ...and only nextLine() moves this.
+    uint16_t          _line_len; // push() side. Bytes kept so far of the line coming in.
+    bool              _dropping; // push() side. The line coming in is bad. Wait for its end.
+    uint16_t          _scan;     // nextLine() side. Where to pick up looking for a newline.
+
+    inline void _mirror(uint16_t i, uint8_t c) {
+      _buf[i & (LINE_RING_SIZE - 1)] = c;
+      _buf[(i & (LINE_RING_SIZE - 1)) + LINE_RING_SIZE] = c;
+    };
+
+    inline bool _store(uint16_t h, uint8_t c) {
+      _mirror(h, c);
+      _line_len = ('\n' == c) ? 0 : (_line_len + 1);
+      _head = h + 1;
+      return true;
+    };
+};
+
+#endif
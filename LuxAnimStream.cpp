@@ -0,0 +1,347 @@
+/*
+File:   LuxAnimStream.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "LuxAnimStream.h"
+#include <StringBuilder.h>
+
+
+/****************************************************************************************************
+* Storage backends                                                                                  *
+****************************************************************************************************/
+
+#if defined(ARDUINO)
+
+SDAnimSource::SDAnimSource() {
+  _open = false;
+}
+
+SDAnimSource::~SDAnimSource() {
+  close();
+}
+
+int8_t SDAnimSource::begin() {
+  return (SD.begin(ANIM_STREAM_SD_CS) ? 0 : -1);
+}
+
+int8_t SDAnimSource::open(const char* path) {
+  close();
+  _file = SD.open(path, FILE_READ);
+  _open = (bool) _file;
+  return (_open ? 0 : -1);
+}
+
+void SDAnimSource::close() {
+  if (_open) _file.close();
+  _open = false;
+}
+
+int32_t SDAnimSource::read(uint32_t offset, uint8_t* buf, uint32_t len) {
+  if (!_open) return -1;
+  if (!_file.seek(offset)) return -1;
+  return _file.read(buf, len);
+}
+
+uint32_t SDAnimSource::size() {
+  return (_open ? _file.size() : 0);
+}
+
+#else
+
+FileAnimSource::FileAnimSource() {
+  _file = NULL;
+  _size = 0;
+}
+
+FileAnimSource::~FileAnimSource() {
+  close();
+}
+
+int8_t FileAnimSource::open(const char* path) {
+  close();
+  _file = fopen(path, "rb");
+  if (NULL == _file) return -1;
+  fseek(_file, 0, SEEK_END);
+  _size = ftell(_file);
+  return 0;
+}
+
+void FileAnimSource::close() {
+  if (NULL != _file) fclose(_file);
+  _file = NULL;
+  _size = 0;
+}
+
+int32_t FileAnimSource::read(uint32_t offset, uint8_t* buf, uint32_t len) {
+  if (NULL == _file) return -1;
+  if (fseek(_file, offset, SEEK_SET)) return -1;
+  return fread(buf, 1, len, _file);
+}
+
+uint32_t FileAnimSource::size() {
+  return _size;
+}
+
+#endif
+
+
+/****************************************************************************************************
+* LuxAnimStream                                                                                     *
+****************************************************************************************************/
+
+LuxAnimStream::LuxAnimStream(RGBmatrixPanel* panel) : _decoder(panel) {
+  frames_drawn = 0;
+  late         = 0;
+  loops        = 0;
+  underruns    = 0;
+  errors       = 0;
+  reads        = 0;
+  bytes_read   = 0;
+  read_us      = 0;
+  _src         = NULL;
+  close();
+}
+
+
+int8_t LuxAnimStream::fill(uint8_t slot, uint32_t sector) {
+  uint32_t t0 = micros();
+  int32_t r = _src->read(sector * ANIM_STREAM_SECTOR, &_buf[slot * ANIM_STREAM_SECTOR], ANIM_STREAM_SECTOR);
+  read_us += micros() - t0;
+  reads++;
+  _sector[slot]     = sector;
+  _sector_len[slot] = r;
+  if (r <= 0) return -1;
+  bytes_read += r;
+  return 0;
+}
+
+
+/*
+* The sector that follows the given one in playback order. At the end of the file,
+*   that's the sector holding the first frame, because we loop.
+*/
+uint32_t LuxAnimStream::next_sector(uint32_t sector) {
+  if (((sector + 1) * ANIM_STREAM_SECTOR) >= _size) {
+    return (_hdr.frames_offset / ANIM_STREAM_SECTOR);
+  }
+  return (sector + 1);
+}
+
+
+/*
+* Make sure the byte at the given offset is sitting in the current slot.
+*/
+int8_t LuxAnimStream::ensure(uint32_t pos) {
+  uint32_t sector = pos / ANIM_STREAM_SECTOR;
+  if ((_sector[_cur] != sector) || (_sector_len[_cur] <= 0)) {
+    uint8_t next = (_cur + 1) % ANIM_STREAM_SECTORS;
+    if ((_ahead > 0) && (_sector[next] == sector) && (_sector_len[next] > 0)) {
+      _cur = next;   // The read-ahead did its job.
+      _ahead--;
+    }
+    else {
+      if (_started) underruns++;
+      _ahead = 0;    // Whatever was read ahead was for somewhere else.
+      if (fill(_cur, sector)) return -1;
+    }
+  }
+  return (((int32_t) (pos % ANIM_STREAM_SECTOR)) < _sector_len[_cur]) ? 0 : -1;
+}
+
+
+/*
+* If there's a free slot in the ring, read the sector after the last one in it.
+*/
+bool LuxAnimStream::readAhead() {
+  if ((NULL == _src) || (_ahead >= (ANIM_STREAM_SECTORS - 1))) return false;
+  uint8_t last = (_cur + _ahead) % ANIM_STREAM_SECTORS;
+  if (_sector_len[last] <= 0) return false;
+  uint8_t slot = (last + 1) % ANIM_STREAM_SECTORS;
+  if (fill(slot, next_sector(_sector[last]))) return false;
+  _ahead++;
+  return true;
+}
+
+
+int16_t LuxAnimStream::next_byte() {
+  if (ensure(_pos)) return -1;
+  return _buf[(_cur * ANIM_STREAM_SECTOR) + (_pos++ % ANIM_STREAM_SECTOR)];
+}
+
+
+int8_t LuxAnimStream::open(AnimSource* src) {
+  close();
+  if (NULL == src) return -1;
+  _src  = src;
+  _size = src->size();
+
+  // The header and palette are read in one go, before the ring is started. The
+  //   palette can run past the first sector, but never past the ring.
+  int32_t r = src->read(0, _buf, LXA_HEADER_LENGTH + 512 + LXA_FRAME_HDR_LENGTH);
+  reads++;
+  if ((r <= 0) || LuxAnimation::parseHeader(_buf, r, &_hdr)) {
+    errors++;
+    close();
+    return -1;
+  }
+  bytes_read += r;
+  if ((_hdr.frames_offset + LXA_FRAME_HDR_LENGTH) > (uint32_t) r) {
+    errors++;
+    close();
+    return -1;
+  }
+  if (FRAME_STREAM_TYPE_KEY != _buf[_hdr.frames_offset]) {
+    errors++;
+    close();
+    return -2;   // We must be able to start (and loop) from the first frame.
+  }
+
+  if (_hdr.palette_size) {
+    LuxAnimation::loadPalette(&_buf[LXA_HEADER_LENGTH], _hdr.palette_size, _palette);
+    _decoder.setPalette(_palette, _hdr.palette_size);
+  }
+  else {
+    _decoder.setPalette(NULL, 0);
+  }
+
+  // Start the ring at the first frame, and fill it.
+  _pos = _hdr.frames_offset;
+  if (fill(0, _pos / ANIM_STREAM_SECTOR)) {
+    errors++;
+    close();
+    return -1;
+  }
+  while (readAhead()) {}
+  return 0;
+}
+
+
+void LuxAnimStream::close() {
+  _src       = NULL;
+  _size      = 0;
+  _pos       = 0;
+  _remaining = 0;
+  _in_frame  = false;
+  _frame_idx = 0;
+  _due_ms    = 0;
+  _started   = false;
+  _cur       = 0;
+  _ahead     = 0;
+  for (uint8_t i = 0; i < ANIM_STREAM_SECTORS; i++) {
+    _sector[i]     = 0;
+    _sector_len[i] = -1;
+  }
+}
+
+
+/*
+* Call this as often as convenient. A frame that isn't finished by slice_end_us is
+*   left part-drawn, and picked up on the next call. Nothing is read ahead from
+*   here. That's up to the caller, between frames.
+*/
+int8_t LuxAnimStream::service(uint32_t now_ms, uint32_t slice_end_us) {
+  if (NULL == _src) return 0;
+
+  if (!_in_frame) {
+    if (_started) {
+      if ((int32_t) (now_ms - _due_ms) < 0) return 0;
+      if ((int32_t) (now_ms - (_due_ms + _hdr.frame_period)) >= 0) {
+        late++;
+        _due_ms = now_ms;   // Don't try to catch up. Deltas can't be skipped anyway.
+      }
+    }
+    else {
+      _due_ms  = now_ms;
+      _started = true;
+    }
+
+    int16_t type = next_byte();
+    int16_t lo   = next_byte();
+    int16_t hi   = next_byte();
+    if ((type < 0) || (lo < 0) || (hi < 0)) {
+      errors++;
+      close();
+      return -1;
+    }
+    _remaining = lo | (hi << 8);
+    _in_frame  = true;
+    _decoder.reset();
+  }
+
+  // Feed the decoder straight out of the ring, crossing sectors as needed.
+  while (_remaining > 0) {
+    if (ensure(_pos)) {
+      errors++;
+      close();
+      return -1;
+    }
+    uint32_t offset = _pos % ANIM_STREAM_SECTOR;
+    uint32_t span   = _sector_len[_cur] - offset;
+    if (span > _remaining)     span = _remaining;
+    if (span > LXA_SLICE_BYTES) span = LXA_SLICE_BYTES;
+    if (_decoder.feed(&_buf[(_cur * ANIM_STREAM_SECTOR) + offset], span)) {
+      errors++;
+      close();
+      return -1;
+    }
+    _pos       += span;
+    _remaining -= span;
+    if ((_remaining > 0) && ((int32_t) (micros() - slice_end_us) >= 0)) return 0;
+  }
+
+  _in_frame = false;
+  if (!_decoder.idle()) {
+    errors++;
+    close();
+    return -1;
+  }
+  frames_drawn++;
+  _due_ms += _hdr.frame_period;
+
+  if (++_frame_idx >= _hdr.frame_count) {
+    _frame_idx = 0;
+    _pos       = _hdr.frames_offset;
+    loops++;
+  }
+  return 1;
+}
+
+
+void LuxAnimStream::printDebug(StringBuilder* output) {
+  output->concat("\n-- LuxAnimStream\n");
+  if (NULL == _src) {
+    output->concat("\tNothing open.\n");
+  }
+  else {
+    output->concatf("\tFrame %u of %u @ %ums\n", _frame_idx, _hdr.frame_count, _hdr.frame_period);
+    output->concatf("\tContainer:     %u bytes (palette %u)\n", _size, _hdr.palette_size);
+    output->concatf("\tRead ahead:    %u of %u sectors\n", _ahead, ANIM_STREAM_SECTORS - 1);
+  }
+  output->concatf("\tFrames drawn:  %u\n", frames_drawn);
+  output->concatf("\tLoops:         %u\n", loops);
+  output->concatf("\tLate:          %u\n", late);
+  output->concatf("\tUnderruns:     %u\n", underruns);
+  output->concatf("\tErrors:        %u\n", errors);
+  output->concatf("\tReads:         %u (%u bytes in %uus)\n", reads, bytes_read, read_us);
+  if (read_us > 0) {
+    output->concatf("\tThroughput:    %u KB/s\n", (uint32_t) (((uint64_t) bytes_read * 1000000) / ((uint64_t) read_us * 1024)));
+  }
+}
@@ -0,0 +1,157 @@
+/*
+File:   LuxAnimStream.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+Plays LXA containers (see LuxAnimation.h) from storage rather than flash.
+
+Reads are a sector at a time, into a ring of sectors that runs ahead of the decoder.
+  Every read is synchronous: whoever asks for a sector waits on the card until it's
+  in. This is not double buffering, and nothing is read in the background. What
+  keeps the card off the decoder's path is only that reads are made between frames.
+  Frames are decoded out of the ring a slice at a time, as LuxAnimation does it.
+  Between frames, readAhead() tops the ring up, one sector per call, so that no
+  slice ever waits on more than one sector from the card. If the decoder ever
+  catches up to the read-ahead, it reads the sector it needs itself, mid-frame, and
+  that is counted as an underrun.
+
+Storage is behind AnimSource so that the player doesn't care where bytes come
+  from. On the WiFire, that is the microSD card. Anywhere else, it is a plain file.
+*/
+
+
+#ifndef __MURUMLUX_LUX_ANIM_STREAM_H__
+#define __MURUMLUX_LUX_ANIM_STREAM_H__
+
+#include "LuxAnimation.h"
+
+#if defined(ARDUINO)
+  #include <SD.h>
+#else
+  #include <stdio.h>
+#endif
+
+
+#define ANIM_STREAM_SECTOR    512     // Bytes per read. One sector of the card.
+#define ANIM_STREAM_SECTORS    16     // In the read-ahead ring.
+#define ANIM_STREAM_SD_CS      52     // The WiFire's card has dedicated pins. See the reference manual, section 9.
+
+
+/*
+* Anything that can hand us bytes from an absolute offset.
+*/
+class AnimSource {
+  public:
+    virtual ~AnimSource() {};
+    virtual int32_t  read(uint32_t offset, uint8_t* buf, uint32_t len) = 0;   // Bytes read, or -1.
+    virtual uint32_t size() = 0;
+};
+
+
+#if defined(ARDUINO)
+class SDAnimSource : public AnimSource {
+  public:
+    SDAnimSource();
+    ~SDAnimSource();
+
+    int8_t   open(const char* path);
+    void     close();
+    int32_t  read(uint32_t offset, uint8_t* buf, uint32_t len);
+    uint32_t size();
+
+    static int8_t begin();      // Mounts the card. Once is enough.
+
+  private:
+    File  _file;
+    bool  _open;
+};
+
+#else
+class FileAnimSource : public AnimSource {
+  public:
+    FileAnimSource();
+    ~FileAnimSource();
+
+    int8_t   open(const char* path);
+    void     close();
+    int32_t  read(uint32_t offset, uint8_t* buf, uint32_t len);
+    uint32_t size();
+
+  private:
+    FILE*    _file;
+    uint32_t _size;
+};
+#endif
+
+
+/*
+* The player. A ring of ANIM_STREAM_SECTORS sectors, each read whole with one
+*   blocking call to the source, and a decoder that follows it around.
+*/
+class LuxAnimStream {
+  public:
+    LuxAnimStream(RGBmatrixPanel*);
+
+    int8_t open(AnimSource*);                  // 0 on success.
+    void   close();
+    int8_t service(uint32_t now_ms, uint32_t slice_end_us);   // 1 once a frame is finished.
+    bool   readAhead();                        // Reads one sector, if there's room. True if it did.
+    inline bool loaded() {     return (NULL != _src);   };
+    inline bool decoding() {   return _in_frame;        };   // A frame is part-drawn.
+
+    void printDebug(StringBuilder*);
+
+    /* Stats */
+    uint32_t frames_drawn;
+    uint32_t late;
+    uint32_t loops;
+    uint32_t underruns;      // Times the decoder had to wait on a read.
+    uint32_t errors;
+    uint32_t reads;
+    uint32_t bytes_read;
+    uint32_t read_us;        // Time spent in AnimSource::read().
+
+
+  private:
+    RectDecoder  _decoder;
+    AnimSource*  _src;
+    LXAHeader    _hdr;
+    uint32_t     _size;
+    uint32_t     _pos;          // Absolute offset of the next byte to decode.
+    uint16_t     _remaining;    // Bytes of the frame in progress still to decode.
+    bool         _in_frame;
+    uint16_t     _frame_idx;
+    uint32_t     _due_ms;
+    bool         _started;
+
+    uint8_t      _buf[ANIM_STREAM_SECTORS * ANIM_STREAM_SECTOR] __attribute__ ((aligned (4)));
+    uint32_t     _sector[ANIM_STREAM_SECTORS];       // Which sector each slot holds...
+    int32_t      _sector_len[ANIM_STREAM_SECTORS];   // ...and how much of it is valid. Negative if nothing.
+    uint8_t      _cur;          // The slot the decoder is in.
+    uint8_t      _ahead;        // Slots after it holding the sectors that follow, in playback order.
+
+    uint16_t     _palette[256];
+
+    int8_t   fill(uint8_t slot, uint32_t sector);
+    int8_t   ensure(uint32_t pos);
+    int16_t  next_byte();
+    uint32_t next_sector(uint32_t sector);
+};
+
+#endif
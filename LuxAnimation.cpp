@@ -0,0 +1,190 @@
+/*
+File:   LuxAnimation.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "LuxAnimation.h"
+#include <StringBuilder.h>
+
+
+LuxAnimation::LuxAnimation(RGBmatrixPanel* panel) : _decoder(panel) {
+  frames_drawn = 0;
+  late         = 0;
+  loops        = 0;
+  errors       = 0;
+  unload();
+}
+
+
+/*
+* Validates the fixed part of a container and fills in the header struct.
+* Returns 0 on success, or a negative value describing what was wrong.
+*/
+int8_t LuxAnimation::parseHeader(const uint8_t* data, uint32_t len, LXAHeader* hdr) {
+  if ((NULL == data) || (len < LXA_HEADER_LENGTH)) return -1;
+  if ((data[0] != 'L') || (data[1] != 'X') || (data[2] != 'A') || (data[3] != '1')) return -2;
+  if ((data[4] != FRAME_IMAGE_WIDTH) || (data[5] != FRAME_IMAGE_HEIGHT)) return -3;
+
+  hdr->frame_count  = data[6] | (data[7] << 8);
+  hdr->frame_period = data[8] | (data[9] << 8);
+  hdr->palette_size = 0;
+  if (data[10] & LXA_FLAG_PALETTE) {
+    hdr->palette_size = (0 == data[11]) ? 256 : data[11];
+  }
+  hdr->frames_offset = LXA_HEADER_LENGTH + (hdr->palette_size * 2);
+  if (0 == hdr->frame_count) return -4;
+  return 0;
+}
+
+
+/*
+* The palette in the container has no alignment guarantees, so we copy it out.
+*/
+int8_t LuxAnimation::loadPalette(const uint8_t* data, uint16_t count, uint16_t* pal) {
+  for (uint16_t i = 0; i < count; i++) {
+    *(pal + i) = *(data + (i*2)) | (*(data + (i*2) + 1) << 8);
+  }
+  return 0;
+}
+
+
+int8_t LuxAnimation::load(const uint8_t* data, uint32_t len) {
+  unload();
+  if (parseHeader(data, len, &_hdr)) {
+    errors++;
+    return -1;
+  }
+  if (_hdr.frames_offset + LXA_FRAME_HDR_LENGTH > len) {
+    errors++;
+    return -1;
+  }
+  if (FRAME_STREAM_TYPE_KEY != *(data + _hdr.frames_offset)) {
+    errors++;
+    return -2;   // We must be able to start (and loop) from the first frame.
+  }
+
+  if (_hdr.palette_size) {
+    loadPalette(data + LXA_HEADER_LENGTH, _hdr.palette_size, _palette);
+    _decoder.setPalette(_palette, _hdr.palette_size);
+  }
+  else {
+    _decoder.setPalette(NULL, 0);
+  }
+  _data   = data;
+  _len    = len;
+  _cursor = _hdr.frames_offset;
+  return 0;
+}
+
+
+void LuxAnimation::unload() {
+  _data      = NULL;
+  _len       = 0;
+  _cursor    = 0;
+  _remaining = 0;
+  _in_frame  = false;
+  _frame_idx = 0;
+  _started   = false;
+  _due_ms    = 0;
+}
+
+
+/*
+* Call this as often as convenient. We only spend time when a frame is actually due,
+*   and then only as much as it takes to decode the tiles that changed. A frame that
+*   isn't finished by slice_end_us is left part-drawn, and picked up on the next call.
+*/
+int8_t LuxAnimation::service(uint32_t now_ms, uint32_t slice_end_us) {
+  if (NULL == _data) return 0;
+
+  if (!_in_frame) {
+    if (_started) {
+      if ((int32_t) (now_ms - _due_ms) < 0) return 0;
+      if ((int32_t) (now_ms - (_due_ms + _hdr.frame_period)) >= 0) {
+        late++;
+        _due_ms = now_ms;   // Don't try to catch up. Deltas can't be skipped anyway.
+      }
+    }
+    else {
+      _due_ms  = now_ms;
+      _started = true;
+    }
+
+    if (_cursor + LXA_FRAME_HDR_LENGTH > _len) {
+      errors++;
+      unload();
+      return -1;
+    }
+    uint16_t f_len = *(_data + _cursor + 1) | (*(_data + _cursor + 2) << 8);
+    if ((_cursor + LXA_FRAME_HDR_LENGTH + f_len) > _len) {
+      errors++;
+      unload();
+      return -1;
+    }
+    _cursor   += LXA_FRAME_HDR_LENGTH;
+    _remaining = f_len;
+    _in_frame  = true;
+    _decoder.reset();
+  }
+
+  while (_remaining > 0) {
+    uint16_t n = (_remaining > LXA_SLICE_BYTES) ? LXA_SLICE_BYTES : _remaining;
+    if (_decoder.feed(_data + _cursor, n)) {
+      errors++;
+      unload();
+      return -1;
+    }
+    _cursor    += n;
+    _remaining -= n;
+    if ((_remaining > 0) && ((int32_t) (micros() - slice_end_us) >= 0)) return 0;
+  }
+
+  _in_frame = false;
+  if (!_decoder.idle()) {
+    errors++;
+    unload();
+    return -1;
+  }
+  frames_drawn++;
+  _due_ms += _hdr.frame_period;
+
+  if (++_frame_idx >= _hdr.frame_count) {
+    _frame_idx = 0;
+    _cursor    = _hdr.frames_offset;
+    loops++;
+  }
+  return 1;
+}
+
+
+void LuxAnimation::printDebug(StringBuilder* output) {
+  output->concat("\n-- LuxAnimation\n");
+  if (NULL == _data) {
+    output->concat("\tNothing loaded.\n");
+  }
+  else {
+    output->concatf("\tFrame %u of %u @ %ums\n", _frame_idx, _hdr.frame_count, _hdr.frame_period);
+    output->concatf("\tContainer:     %u bytes (palette %u)\n", _len, _hdr.palette_size);
+  }
+  output->concatf("\tFrames drawn:  %u\n", frames_drawn);
+  output->concatf("\tLoops:         %u\n", loops);
+  output->concatf("\tLate:          %u\n", late);
+  output->concatf("\tErrors:        %u\n", errors);
+}
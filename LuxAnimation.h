@@ -0,0 +1,108 @@
+/*
+File:   LuxAnimation.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+A compact animation container (LXA) for things that live in flash.
+
+The raw logos in static_images.c cost 12KB apiece. An animation stored that way
+  would not fit for more than a second or two. So instead we store a keyframe, and
+  then only the tiles that changed in each subsequent frame. Both are coded as the
+  same rect lists that FrameStream uses, so the decoder is shared.
+
+Layout (all multi-byte fields are little-endian):
+  Header, 12 bytes:
+    'L' 'X' 'A' '1'
+    width (u8), height (u8)      Must be 96x64 for now.
+    frame count (u16)
+    frame period in ms (u16)
+    flags (u8)                   Bit 0: a palette follows the header.
+    palette size (u8)            Zero means 256.
+  Palette (optional):
+    RGB565 (u16) per entry. When present, every pixel in the rect lists is a one-byte index.
+  Frames, back-to-back:
+    type (u8)                    FRAME_STREAM_TYPE_KEY or FRAME_STREAM_TYPE_DELTA.
+    length (u16)
+    rect list (length bytes)
+  The first frame must be a keyframe. Playback loops back to it.
+
+A frame is decoded a bite at a time, with a look at the clock between bites, so that
+  it can be spread over as many of the effect's slices as it takes (see Effect.h).
+
+image_converter/lxa_encode.py builds these from a PNG sequence.
+*/
+
+
+#ifndef __MURUMLUX_LUX_ANIMATION_H__
+#define __MURUMLUX_LUX_ANIMATION_H__
+
+#include <stdlib.h>
+#include "FrameStream.h"
+
+#define LXA_HEADER_LENGTH      12
+#define LXA_FRAME_HDR_LENGTH    3
+#define LXA_FLAG_PALETTE     0x01
+#define LXA_SLICE_BYTES        64    // Decoded between looks at the clock.
+
+
+typedef struct lxa_header_t {
+  uint16_t frame_count;
+  uint16_t frame_period;      // ms
+  uint16_t palette_size;      // Zero if there is no palette.
+  uint32_t frames_offset;     // Where the first frame header sits, from the start of the container.
+} LXAHeader;
+
+
+class LuxAnimation {
+  public:
+    LuxAnimation(RGBmatrixPanel*);
+
+    int8_t load(const uint8_t* data, uint32_t len);   // 0 on success.
+    void   unload();
+    int8_t service(uint32_t now_ms, uint32_t slice_end_us);   // 1 once a frame is finished.
+    inline bool loaded() {     return (NULL != _data);   };
+    inline bool decoding() {   return _in_frame;         };   // A frame is part-drawn.
+
+    void printDebug(StringBuilder*);
+
+    static int8_t  parseHeader(const uint8_t* data, uint32_t len, LXAHeader*);
+    static int8_t  loadPalette(const uint8_t* data, uint16_t count, uint16_t* pal);
+
+    /* Stats */
+    uint32_t frames_drawn;
+    uint32_t late;           // Frame slots we were too busy to hit on time.
+    uint32_t loops;
+    uint32_t errors;
+
+
+  private:
+    RectDecoder     _decoder;
+    const uint8_t*  _data;
+    uint32_t        _len;
+    LXAHeader       _hdr;
+    uint32_t        _cursor;      // Offset of the next byte to decode.
+    uint16_t        _remaining;   // Bytes of the frame in progress still to decode.
+    bool            _in_frame;
+    uint16_t        _frame_idx;
+    uint32_t        _due_ms;
+    bool            _started;
+    uint16_t        _palette[256];
+};
+
+#endif
@@ -0,0 +1,106 @@
+/*
+File:   LuxProfiler.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "LuxProfiler.h"
+#include <string.h>
+#include <StringBuilder.h>
+
+
+/* Ticks as microseconds, to two places. */
+static void concat_ticks(StringBuilder* output, uint32_t t) {
+  uint32_t tpu = LUX_PROFILER_TICKS_PER_US;
+  output->concatf("%u.%02uus", t / tpu, ((t % tpu) * 100) / tpu);
+}
+
+
+LuxProfiler::LuxProfiler() {
+  _count       = 0;
+  _report_next = -1;
+  _since_ms    = 0;
+  _report_ms   = 0;
+}
+
+
+int8_t LuxProfiler::createScope(const char* name) {
+  if (_count >= LUX_PROFILER_MAX_SCOPES) return -1;
+  _clear(&_scopes[_count]);
+  _scopes[_count].name = name;
+  return _count++;
+}
+
+
+void LuxProfiler::_clear(LuxProfScope* s) {
+  const char* name = s->name;
+  memset(s, 0, sizeof(LuxProfScope));
+  s->name = name;
+  s->min  = 0xFFFFFFFF;
+}
+
+
+void LuxProfiler::reset() {
+  for (uint8_t i = 0; i < _count; i++) _clear(&_scopes[i]);
+}
+
+
+void LuxProfiler::startReport(uint32_t now_ms) {
+  memcpy(_report, _scopes, _count * sizeof(LuxProfScope));
+  reset();
+  _report_ms   = now_ms - _since_ms;
+  _since_ms    = now_ms;
+  _report_next = 0;
+}
+
+
+/*
+* The first call writes the heading. Every call after it writes one scope, until
+*   they have all been written.
+*/
+bool LuxProfiler::reportSome(StringBuilder* output) {
+  if (_report_next < 0) return false;
+  if (0 == _report_next) {
+    output->concatf("\n-- Profile: %ums, %u ticks/us\n", _report_ms, (uint32_t) LUX_PROFILER_TICKS_PER_US);
+  }
+  if (_report_next >= _count) {
+    _report_next = -1;
+    return false;
+  }
+
+  LuxProfScope* s = &_report[_report_next++];
+  output->concatf("\t%-12s %8u runs", s->name, s->count);
+  if (s->count) {
+    output->concat("  min ");
+    concat_ticks(output, s->min);
+    output->concat("  mean ");
+    concat_ticks(output, (uint32_t) (s->sum / s->count));
+    output->concat("  max ");
+    concat_ticks(output, s->max);
+    output->concat("\n\t\t");
+    for (uint8_t i = 0; i < LUX_PROFILER_BUCKETS; i++) {
+      if (0 == s->hist[i]) continue;
+      output->concat(" >=");
+      concat_ticks(output, (uint32_t) 1 << i);
+      output->concatf(":%u", s->hist[i]);
+    }
+  }
+  output->concat("\n");
+  return true;
+}
@@ -0,0 +1,136 @@
+/*
+File:   LuxProfiler.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+Where the time goes, timed in core timer ticks.
+
+A scope is a named stretch of code. It is created once, like a scheduler job, and
+  the id that comes back is handed to a LuxProfTimer at the top of the code to be
+  timed. The timer reads the clock when it is made and again when it goes out of
+  scope, and the difference is added to the scope's stats: count, min, mean, max,
+  and a histogram with a bucket for each power of two ticks.
+
+On the board, the clock is the MIPS CP0 Count register. It is read in a single
+  instruction and counts at half the core clock (10ns on the WiFire), so a scope
+  costs a few dozen instructions, and can be put around something as small as a
+  row of pixels. Off the board, it is a monotonic clock, counted in the same 10ns
+  ticks. Either way, the count wraps every 43 seconds or so, so a single timing has
+  to be shorter than that.
+
+Everything lives in fixed arrays. Nothing is allocated.
+
+Writing the table out over serial takes far longer than anything it measures. So
+  startReport() only copies the stats aside, and starts the live ones over. Then
+  reportSome() writes out one scope of the copy at a time, and the main loop calls
+  it once per pass, between everything else it does.
+*/
+
+
+#ifndef __MURUMLUX_LUX_PROFILER_H__
+#define __MURUMLUX_LUX_PROFILER_H__
+
+#include <inttypes.h>
+#include <stdlib.h>
+
+#define LUX_PROFILER_MAX_SCOPES   16
+#define LUX_PROFILER_BUCKETS      32    // One per bit of a tick count.
+
+#if defined(ARDUINO)
+  #define LUX_PROFILER_TICKS_PER_US   (F_CPU / 2000000UL)
+#else
+  #include <time.h>
+  #define LUX_PROFILER_TICKS_PER_US   100UL   // As on the WiFire.
+#endif
+
+class StringBuilder;
+
+
+typedef struct lux_prof_scope_t {
+  const char* name;
+  uint32_t    count;
+  uint32_t    min;       // Ticks.
+  uint32_t    max;
+  uint64_t    sum;
+  uint32_t    hist[LUX_PROFILER_BUCKETS];   // hist[i] counts timings of 2^i to 2^(i+1)-1 ticks.
+} LuxProfScope;
+
+
+class LuxProfiler {
+  public:
+    LuxProfiler();
+
+    // Returns the id of the new scope, or -1 if there's no room.
+    int8_t createScope(const char* name);
+
+    static inline uint32_t ticks() {
+      #if defined(ARDUINO)
+        uint32_t c;
+        __asm__ __volatile__ ("mfc0 %0, $9" : "=r" (c));   // CP0 Count.
+        return c;
+      #else
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint32_t) ((((uint64_t) ts.tv_sec * 1000000000ULL) + ts.tv_nsec) / 10);
+      #endif
+    };
+
+    inline void record(int8_t id, uint32_t t) {
+      if ((id < 0) || (id >= _count)) return;
+      LuxProfScope* s = &_scopes[id];
+      s->count++;
+      s->sum += t;
+      if (t < s->min) s->min = t;
+      if (t > s->max) s->max = t;
+      s->hist[31 - __builtin_clz(t | 1)]++;
+    };
+
+    void reset();                       // Starts every scope's stats over.
+    void startReport(uint32_t now_ms);  // Takes a copy to report from, and resets.
+    bool reportSome(StringBuilder*);    // One scope of the copy. False once there's no more.
+    inline bool reporting() {   return _report_next >= 0;   };
+
+
+  private:
+    LuxProfScope _scopes[LUX_PROFILER_MAX_SCOPES];
+    LuxProfScope _report[LUX_PROFILER_MAX_SCOPES];
+    uint8_t      _count;
+    int8_t       _report_next;   // -1 when there's no report going.
+    uint32_t     _since_ms;      // When the stats were last started over...
+    uint32_t     _report_ms;     // ...and how long the copy covers.
+
+    void _clear(LuxProfScope*);
+};
+
+
+/*
+* Times the rest of the block it is declared in, against a scope.
+*/
+class LuxProfTimer {
+  public:
+    inline LuxProfTimer(LuxProfiler* p, int8_t id) : _p(p), _id(id), _t0(LuxProfiler::ticks()) {};
+    inline ~LuxProfTimer() {   _p->record(_id, LuxProfiler::ticks() - _t0);   };
+
+  private:
+    LuxProfiler* _p;
+    int8_t       _id;
+    uint32_t     _t0;
+};
+
+#endif
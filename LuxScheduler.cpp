@@ -0,0 +1,116 @@
+/*
+File:   LuxScheduler.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "LuxScheduler.h"
+#include <string.h>
+#include <StringBuilder.h>
+
+
+LuxScheduler::LuxScheduler() {
+  _count = 0;
+  memset(_jobs, 0, sizeof(_jobs));
+}
+
+
+int8_t LuxScheduler::createSchedule(const char* name, uint32_t period_us, uint8_t max_catchup, bool one_shot, LuxJobFxn fxn) {
+  if ((NULL == fxn) || (0 == period_us)) return -1;
+  if (_count >= LUX_SCHEDULER_MAX_JOBS) return -1;
+  LuxJob* job = &_jobs[_count];
+  job->fxn         = fxn;
+  job->name        = name;
+  job->period      = period_us;
+  job->max_catchup = (0 == max_catchup) ? 1 : max_catchup;
+  job->one_shot    = one_shot;
+  job->enabled     = false;
+  return _count++;
+}
+
+
+void LuxScheduler::enableSchedule(int8_t pid, uint32_t now_us) {
+  if ((pid < 0) || (pid >= _count)) return;
+  _jobs[pid].due     = now_us + _jobs[pid].period;
+  _jobs[pid].enabled = true;
+}
+
+
+void LuxScheduler::disableSchedule(int8_t pid) {
+  if ((pid < 0) || (pid >= _count)) return;
+  _jobs[pid].enabled = false;
+}
+
+
+void LuxScheduler::delaySchedule(int8_t pid, uint32_t now_us) {
+  if ((pid < 0) || (pid >= _count)) return;
+  _jobs[pid].due = now_us + _jobs[pid].period;
+}
+
+
+/*
+* The deadline already set is kept. The new period applies after it.
+*/
+void LuxScheduler::alterSchedulePeriod(int8_t pid, uint32_t period_us) {
+  if ((pid < 0) || (pid >= _count) || (0 == period_us)) return;
+  _jobs[pid].period = period_us;
+}
+
+
+/*
+* Runs whatever is due. A job that is behind is run up to max_catchup times, each
+*   run taking one deadline. If it is still behind after that, the rest of the
+*   deadlines it owes are dropped.
+*/
+uint8_t LuxScheduler::serviceScheduledEvents(uint32_t now_us) {
+  uint8_t ret = 0;
+  for (uint8_t i = 0; i < _count; i++) {
+    LuxJob* job = &_jobs[i];
+    uint8_t n = 0;
+    while (job->enabled && ((int32_t) (now_us - job->due) >= 0) && (n < job->max_catchup)) {
+      uint32_t late = now_us - job->due;
+      if (late > job->late_max) job->late_max = late;
+      job->late_avg4 += late - (job->late_avg4 >> 2);
+      job->due += job->period;
+      job->runs++;
+      if (job->one_shot) job->enabled = false;
+      n++;
+      // The job may reschedule itself, so this comes after we are done with it.
+      job->fxn();
+    }
+    if (job->enabled && ((int32_t) (now_us - job->due) >= 0)) {
+      uint32_t drop = ((now_us - job->due) / job->period) + 1;
+      job->missed += drop;
+      job->due    += drop * job->period;
+    }
+    ret += n;
+  }
+  return ret;
+}
+
+
+void LuxScheduler::printDebug(StringBuilder* output) {
+  output->concat("\n-- LuxScheduler\n");
+  for (uint8_t i = 0; i < _count; i++) {
+    LuxJob* job = &_jobs[i];
+    output->concatf("\t%u %-10s %c %8uus  %u runs, %u missed, late %uus avg %uus max\n",
+      i, job->name, (job->enabled ? '+' : ' '), job->period,
+      job->runs, job->missed, job->late_avg4 >> 2, job->late_max);
+  }
+}
@@ -0,0 +1,100 @@
+/*
+File:   LuxScheduler.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+Fixed-timestep jobs, for pacing frames and the other periodic things the sketch does.
+
+This follows ManuvrOS's Scheduler (createSchedule(), a PID back, and a service call
+  from the main loop), so that the sketch can be moved onto it once StaticHub is
+  brought up here. It differs in how time is kept. A job's next deadline is its
+  last deadline plus its period, not the time it last ran plus its period. So a
+  job that runs late doesn't push every run after it later, and 100 frames at 10ms
+  take one second, not one second plus the sum of the render times.
+
+When a job falls behind, it is run again on the same service() call to catch up,
+  but only so many times (max_catchup). Past that limit, the ticks it missed are
+  dropped, not replayed. They are counted, and the job picks up again on its next
+  deadline after now. A job with a max_catchup of 1 never catches up at all. The
+  sketch's frame job is one of those, since a frame can only start once the last
+  one is drawn, and so an effect that can't keep up runs at whatever rate it can
+  manage, on the period's ticks, rather than starving everything else.
+
+Lateness (how long after its deadline a job actually ran) is kept per job, as
+  jitter stats. Times are in microseconds. Deadlines are compared with wrapping
+  arithmetic, so periods must be under about 35 minutes.
+*/
+
+
+#ifndef __MURUMLUX_LUX_SCHEDULER_H__
+#define __MURUMLUX_LUX_SCHEDULER_H__
+
+#include <inttypes.h>
+#include <stdlib.h>
+
+#define LUX_SCHEDULER_MAX_JOBS   8
+
+class StringBuilder;
+
+typedef void (*LuxJobFxn)(void);
+
+
+typedef struct lux_job_t {
+  LuxJobFxn   fxn;
+  const char* name;
+  uint32_t    period;        // us
+  uint32_t    due;           // micros() at which it next runs.
+  uint8_t     max_catchup;   // Runs allowed per service() when behind. At least 1.
+  bool        enabled;
+  bool        one_shot;      // Disables itself after it runs.
+
+  /* Stats */
+  uint32_t    runs;
+  uint32_t    missed;        // Deadlines dropped because we were too far behind.
+  uint32_t    late_max;      // Worst lateness, in us.
+  uint32_t    late_avg4;     // Lateness, averaged over the last few runs, times 4.
+} LuxJob;
+
+
+class LuxScheduler {
+  public:
+    LuxScheduler();
+
+    // Returns the PID of the new job, or -1 if there's no room.
+    int8_t createSchedule(const char* name, uint32_t period_us, uint8_t max_catchup, bool one_shot, LuxJobFxn);
+
+    void   enableSchedule(int8_t pid, uint32_t now_us);    // Next run is a period from now.
+    void   disableSchedule(int8_t pid);
+    void   delaySchedule(int8_t pid, uint32_t now_us);     // Start the period over, from now.
+    void   alterSchedulePeriod(int8_t pid, uint32_t period_us);
+    inline bool scheduleEnabled(int8_t pid) {
+      return ((pid >= 0) && (pid < _count) && _jobs[pid].enabled);
+    };
+
+    uint8_t serviceScheduledEvents(uint32_t now_us);   // Returns the number of runs made.
+
+    void printDebug(StringBuilder*);
+
+
+  private:
+    LuxJob  _jobs[LUX_SCHEDULER_MAX_JOBS];
+    uint8_t _count;
+};
+
+#endif
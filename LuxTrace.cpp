@@ -0,0 +1,238 @@
+/*
+File:   LuxTrace.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "LuxTrace.h"
+#include <string.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+
+/****************************************************************************************************
+* TraceWriter                                                                                       *
+****************************************************************************************************/
+
+TraceWriter::TraceWriter() {
+  _open  = false;
+  _len   = 0;
+  bytes  = 0;
+  errors = 0;
+}
+
+TraceWriter::~TraceWriter() {
+  close();
+}
+
+
+int8_t TraceWriter::open(const char* path) {
+  close();
+  bytes  = 0;
+  errors = 0;
+  #if defined(ARDUINO)
+    SD.remove((char*) path);
+    _file = SD.open(path, FILE_WRITE);
+    _open = (bool) _file;
+  #else
+    _file = fopen(path, "wb");
+    _open = (NULL != _file);
+  #endif
+  return (_open ? 0 : -1);
+}
+
+
+void TraceWriter::close() {
+  if (!_open) return;
+  flush();
+  #if defined(ARDUINO)
+    _file.close();
+  #else
+    fclose(_file);
+  #endif
+  _open = false;
+}
+
+
+void TraceWriter::flush() {
+  if (0 == _len) return;
+  #if defined(ARDUINO)
+    uint32_t w = _file.write((const uint8_t*) _buf, _len);
+  #else
+    uint32_t w = fwrite(_buf, 1, _len, _file);
+  #endif
+  if (w != _len) errors++;
+  bytes += _len;
+  _len   = 0;
+}
+
+
+void TraceWriter::write(const char* str, uint16_t len) {
+  if (!_open) return;
+  while (len > 0) {
+    uint16_t n = TRACE_CHUNK - _len;
+    if (n > len) n = len;
+    memcpy(&_buf[_len], str, n);
+    _len += n;
+    str  += n;
+    len  -= n;
+    if (TRACE_CHUNK == _len) flush();
+  }
+}
+
+
+void TraceWriter::concatf(const char* fmt, ...) {
+  char line[TRACE_MAX_LINE + 1];
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(line, sizeof(line), fmt, args);
+  va_end(args);
+  if (n < 0) return;
+  write(line, (n > TRACE_MAX_LINE) ? TRACE_MAX_LINE : n);
+}
+
+
+
+/****************************************************************************************************
+* TraceReader                                                                                       *
+****************************************************************************************************/
+
+TraceReader::TraceReader() {
+  _open     = false;
+  _pos      = 0;
+  _len      = 0;
+  effect_id = 0;
+  frame_us  = 0;
+  settings  = false;
+  gol_rule  = 0;
+  scan_order      = 0;
+  plasma_bilinear = false;
+  filter_alpha    = 0;
+  filter_beta     = 0;
+  lines     = 0;
+  errors    = 0;
+}
+
+TraceReader::~TraceReader() {
+  close();
+}
+
+
+/*
+* Also reads the header. A file without one isn't a trace. Version 1 headers stop
+*   after the frame period.
+*/
+int8_t TraceReader::open(const char* path) {
+  close();
+  #if defined(ARDUINO)
+    _file = SD.open(path, FILE_READ);
+    _open = (bool) _file;
+  #else
+    _file = fopen(path, "rb");
+    _open = (NULL != _file);
+  #endif
+  if (!_open) return -1;
+  _pos   = 0;
+  _len   = 0;
+  lines  = 0;
+  errors = 0;
+
+  unsigned int ver = 0, effect = 0, frame = 0, rule = 0, order = 0, fill = 0, alpha = 0, beta = 0;
+  int fields = (read_line() < 0) ? 0 : sscanf(_line, "# murumlux-trace %u effect %u frame %u rule %u order %u fill %u filter %u %u",
+                                              &ver, &effect, &frame, &rule, &order, &fill, &alpha, &beta);
+  bool ok = (fields >= 3) && (0 != frame);
+  if (ok) {
+    if (1 == ver)                  ok = (3 == fields);
+    else if (TRACE_VERSION == ver) ok = (8 == fields);
+    else                           ok = false;
+  }
+  if (!ok) {
+    close();
+    return -2;
+  }
+  effect_id = effect;
+  frame_us  = frame;
+  settings  = (TRACE_VERSION == ver);
+  gol_rule        = rule;
+  scan_order      = order;
+  plasma_bilinear = (0 != fill);
+  filter_alpha    = alpha;
+  filter_beta     = beta;
+  return 0;
+}
+
+
+void TraceReader::close() {
+  if (!_open) return;
+  #if defined(ARDUINO)
+    _file.close();
+  #else
+    fclose(_file);
+  #endif
+  _open = false;
+}
+
+
+/*
+* A line too long to keep is cut short. Carriage returns are dropped.
+*/
+int16_t TraceReader::read_line() {
+  uint16_t n = 0;
+  bool     any = false;
+  while (true) {
+    if (_pos >= _len) {
+      #if defined(ARDUINO)
+        int32_t r = _file.read((uint8_t*) _buf, TRACE_CHUNK);
+      #else
+        int32_t r = fread(_buf, 1, TRACE_CHUNK, _file);
+      #endif
+      if (r <= 0) break;
+      _len = r;
+      _pos = 0;
+    }
+    char c = _buf[_pos++];
+    any = true;
+    if ('\n' == c) break;
+    if (('\r' != c) && (n < TRACE_MAX_LINE)) _line[n++] = c;
+  }
+  _line[n] = '\0';
+  return any ? n : -1;
+}
+
+
+bool TraceReader::next(uint32_t* stamp_us, const char** line, uint16_t* len) {
+  if (!_open) return false;
+  int16_t n;
+  while ((n = read_line()) >= 0) {
+    if ((0 == n) || ('#' == _line[0])) continue;
+    char* rest;
+    unsigned long stamp = strtoul(_line, &rest, 10);
+    if ((rest == _line) || (' ' != *rest)) {
+      errors++;
+      continue;
+    }
+    rest++;
+    *stamp_us = stamp;
+    *line     = rest;
+    *len      = n - (rest - _line);
+    lines++;
+    return true;
+  }
+  return false;
+}
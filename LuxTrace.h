@@ -0,0 +1,139 @@
+/*
+File:   LuxTrace.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+Gesture traces: what the e-field box said, and when, so that a session can be
+  played back later without a hand in front of the sensor.
+
+A trace is a text file. It starts with a header giving the effect that was running,
+  the frame period, and every setting from the console that changes what gets drawn
+  (the GoL rule, the scan order, the plasma fill, and the position filter's gains).
+  Then it has one line per line from the link, each prefixed by its time in
+  microseconds from the start of the recording:
+    # murumlux-trace 2 effect 4 frame 10000 rule 0 order 3 fill 1 filter 160 64
+    15022 ATCHVAR 1 0x7a12,0x9d13,0x007b
+    30104 ATCHVAR 4 1
+  Lines starting with # are comments. A version 1 trace has only the effect and the
+  frame period, and is replayed under whatever the settings are at the time.
+
+TraceWriter and TraceReader just move those lines to and from storage, in whole
+  chunks. The sketch does the recording and the replaying. Like LuxAnimStream, the
+  storage is the microSD card on the WiFire, and a plain file anywhere else, so a
+  trace can be read back by a host build just as well.
+*/
+
+
+#ifndef __MURUMLUX_LUX_TRACE_H__
+#define __MURUMLUX_LUX_TRACE_H__
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include "LineRing.h"
+
+#if defined(ARDUINO)
+  #include <SD.h>
+#else
+  #include <stdio.h>
+#endif
+
+#define TRACE_CHUNK        512     // Bytes per read or write. One sector.
+#define TRACE_MAX_LINE     LINE_RING_MAX_LINE
+#define TRACE_VERSION      2
+
+
+/*
+* Writes lines out a chunk at a time. Nothing is written until a chunk fills, or
+*   the file is closed.
+*/
+class TraceWriter {
+  public:
+    TraceWriter();
+    ~TraceWriter();
+
+    int8_t open(const char* path);      // Replaces anything that was there. 0 on success.
+    void   close();
+    inline bool isOpen() {   return _open;   };
+
+    void   write(const char* str, uint16_t len);
+    void   concatf(const char* fmt, ...);  // One line at most.
+
+    uint32_t bytes;
+    uint32_t errors;     // Chunks that didn't make it out whole.
+
+
+  private:
+    #if defined(ARDUINO)
+      File   _file;
+    #else
+      FILE*  _file;
+    #endif
+    bool     _open;
+    uint16_t _len;
+    char     _buf[TRACE_CHUNK];
+
+    void flush();
+};
+
+
+/*
+* Reads a trace back, one line at a time.
+*/
+class TraceReader {
+  public:
+    TraceReader();
+    ~TraceReader();
+
+    int8_t open(const char* path);      // 0 on success.
+    void   close();
+    inline bool isOpen() {   return _open;   };
+
+    // The next line that isn't a comment, and its time. The line is good until the next call.
+    bool   next(uint32_t* stamp_us, const char** line, uint16_t* len);
+
+    // Filled in by open(), from the header.
+    uint8_t  effect_id;
+    uint32_t frame_us;
+    bool     settings;       // False for a version 1 trace. Then the rest are zero.
+    uint8_t  gol_rule;       // Index into LIFE_RULE_LIST.
+    uint8_t  scan_order;
+    bool     plasma_bilinear;
+    uint16_t filter_alpha;
+    uint16_t filter_beta;
+
+    uint32_t lines;
+    uint32_t errors;     // Lines we couldn't make sense of.
+
+
+  private:
+    #if defined(ARDUINO)
+      File   _file;
+    #else
+      FILE*  _file;
+    #endif
+    bool     _open;
+    uint16_t _pos;
+    uint16_t _len;
+    char     _buf[TRACE_CHUNK];
+    char     _line[TRACE_MAX_LINE + 1];
+
+    int16_t  read_line();      // Into _line. The length, or -1 at the end.
+};
+
+#endif
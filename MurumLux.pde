@@ -4,25 +4,82 @@
 */
 
 
-#define GOL_BOARD_WIDTH  96
-#define GOL_BOARD_HEIGHT 64
-
-#include <ManuvrOS.h>
+#if defined(ARDUINO)
+  #include <ManuvrOS.h>
+  #include "StaticHub.h"
+#endif
 #include <StringBuilder.h>
-#include "StaticHub.h"
 #include <Arduino.h>
 
 #include <Adafruit_GFX.h>   // Core graphics library
 #include <RGBmatrixPanel.h> // Hardware-specific library
+#include "FrameStream.h"
+#include "LuxAnimation.h"
+#if defined(ARDUINO)
+  #include <SD.h>
+#endif
+#include "LuxAnimStream.h"
+#include "GoLBoard.h"
+#include "HashLife.h"
+#include "Effect.h"
+#include "LuxScheduler.h"
+#include "LineRing.h"
+#include "Atchvar.h"
+#include "GestureQueue.h"
+#include "PositionFilter.h"
+#include "LuxTrace.h"
+#include "LuxProfiler.h"
+#include "FrameGovernor.h"
 
 
 #include "static_images.c"
+#include "static_animations.c"
 
-uint32_t    tStart  = 0;
 uint32_t    led     = HIGH;
 
 
-uint32_t last_interaction = 0;
+// Frames, the logo rotation and the idle timeout all run as fixed-timestep jobs. See
+//   LuxScheduler.h.
+LuxScheduler scheduler;
+int8_t pid_frame       = -1;
+int8_t pid_logo_rotate = -1;
+int8_t pid_idle        = -1;
+
+// Each effect's frame period is picked by the governor, between bounds given to it when
+//   it is registered. See FrameGovernor.h.
+FrameGovernor governor;
+uint32_t frame_period_us = EFFECT_PERIOD_MIN_US;   // What the frame job is running at.
+uint32_t governed_frames = 0;                      // effects.frames_done, as of the last look.
+
+// Where the time goes. See LuxProfiler.h. The scopes are made in setup(), and time
+//   nothing until then.
+LuxProfiler profiler;
+int8_t prof_frame   = -1;   // The frame job: taking input, and starting a frame.
+int8_t prof_slice   = -1;   // A slice of rendering, whatever the effect.
+int8_t prof_plasma  = -1;   // A slice of the plasma...
+int8_t prof_rows    = -1;   // ...and its writes of row pairs to the panel.
+int8_t prof_life    = -1;   // Stepping the GoL board...
+int8_t prof_print   = -1;   // ...and printing it.
+int8_t prof_logo    = -1;   // Columns of a logo, pixel by pixel.
+int8_t prof_rx      = -1;   // Draining Serial1...
+int8_t prof_parse   = -1;   // ...and parsing the lines from it.
+int8_t prof_display = -1;
+
+#define LOGO_ROTATE_MS    9001
+#define IDLE_TIMEOUT_MS  60000
+
+// Recording what the e-field box says, and playing it back. See "Gesture traces", below.
+//   On the card, or off the board, in the working directory.
+#if defined(ARDUINO)
+  #define TRACE_PATH          "/trace.txt"
+  #define TRACE_REPORT_PATH   "/replay.txt"
+#else
+  #define TRACE_PATH          "trace.txt"
+  #define TRACE_REPORT_PATH   "replay.txt"
+#endif
+#define TRACE_SEED          0x4C7578   // Every replay starts from the same GoL board.
+bool trace_recording = false;
+bool trace_replaying = false;
 
 
 
@@ -48,6 +105,41 @@ bool update_frame = true;
 
 RGBmatrixPanel matrix;
 
+// Frames pushed to us by a remote host arrive interleaved with the ATCHVAR traffic.
+FrameStream frame_stream(&matrix);
+
+// Plays LXA containers (see LuxAnimation.h) as an effect. From flash...
+LuxAnimation animation(&matrix);
+
+// ...or from the microSD card, if one is inserted with an animation on it. Off the
+//   board, from a file in the working directory.
+#if defined(ARDUINO)
+  #define SD_ANIMATION_PATH  "/murum.lxa"
+  SDAnimSource    sd_source;
+#else
+  #define SD_ANIMATION_PATH  "murum.lxa"
+  FileAnimSource  sd_source;
+#endif
+LuxAnimStream anim_stream(&matrix);
+bool anim_on_card = false;   // There was one to stream when we started.
+
+// Only one of them is open at a time. Opening the stream lets go of the flash player.
+int8_t open_anim_stream() {
+  animation.unload();
+  if (sd_source.open(SD_ANIMATION_PATH)) return -1;
+  if (anim_stream.open(&sd_source)) {
+    sd_source.close();
+    return -2;
+  }
+  return 0;
+}
+
+void close_anim_stream() {
+  anim_stream.close();
+  sd_source.close();
+}
+
+
 
 
 void blackout() {
@@ -65,24 +157,32 @@ void blackout() {
 
 
 /*
-* Given one of the static images, write it to the frame buffer.
+* Given one of the static images, write columns [x0, x1) of it to the frame buffer.
 */
-void set_logo(const char* logo) {
+void set_logo_columns(const char* logo, uint8_t x0, uint8_t x1) {
+  LuxProfTimer prof(&profiler, prof_logo);
   uint16_t* ptr_cast = (uint16_t*) logo;
   /* Until the render buffer is torn off the top of the framebuffer, we
      do this to prevent nasty artifacts. */
   matrix.haltDMA();
   while (!matrix.DMADone()) {}
 
-  for (int a = 0; a < 96*64; a++) {
+  for (int a = x0*96; a < x1*96; a++) {
     matrix.drawPixel(((a)/96), (95-((a)%96)), *((uint16_t*)ptr_cast+a));
   }
 }
 
 
+/*
+* Given one of the static images, write it to the frame buffer.
+*/
+void set_logo(const char* logo) {
+  set_logo_columns(logo, 0, 64);
+}
+
+
 void draw_cursor(int x, int y, uint16_t color) {
   matrix.drawPixel(x, y, color);
-  uint8_t i = 0;
   for (uint8_t i = 1; i < 3; i++) {
     if ((x+i) < 96) matrix.drawPixel(x+i, y, color);
     if ((x-i) >= 0) matrix.drawPixel(x-i, y, color);
@@ -92,6 +192,21 @@ void draw_cursor(int x, int y, uint16_t color) {
 }
 
 
+/*
+* The same cross as draw_cursor(), pre-sliced so that moving it costs a few masked
+*   writes per plane rather than a full color conversion per pixel.
+*/
+static const uint16_t cursor_pixels[25] = {
+  0,      0,      0xFFE0, 0,      0,
+  0,      0,      0xFFE0, 0,      0,
+  0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0,
+  0,      0,      0xFFE0, 0,      0,
+  0,      0,      0xFFE0, 0,      0
+};
+
+RGBSprite cursor_sprite = {0, 0, NULL};
+
+
 /*****************************************************************************************
 * Coherent noise
 ******************************************************************************************
@@ -142,46 +257,236 @@ static const int8_t sinetab[256] = {
 };
 
 
-float radius1  = 16.3, radius2  = 23.0, radius3  = 40.8, radius4  = 44.2,
-            centerx1 = 16.1, centerx2 = 11.6, centerx3 = 23.4, centerx4 =  4.1, 
-            centery1 =  8.7, centery2 =  6.5, centery3 = 14.0, centery4 = -2.9;
-float       angle1   =  0.0, angle2   =  0.0, angle3   =  0.0, angle4   =  0.0;
-float       angle1_s =  0.0, angle2_s =  0.0, angle3_s =  0.0, angle4_s =  0.0;
-long        hueShift =  0;
-int         hue_shift_s = 2;
-int         x1, x2, x3, x4, _y1, _y2, _y3, _y4, sx1, sx2, sx3, sx4;
-
-void advance_plasma() {
-  unsigned char x, y;
-  long          value;
-  sx1 = (int)(cos(angle1) * radius1 + centerx1);
-  sx2 = (int)(cos(angle2) * radius2 + centerx2);
-  sx3 = (int)(cos(angle3) * radius3 + centerx3);
-  sx4 = (int)(cos(angle4) * radius4 + centerx4);
-  _y1 = (int)(sin(angle1) * radius1 + centery1);
-  _y2 = (int)(sin(angle2) * radius2 + centery2);
-  _y3 = (int)(sin(angle3) * radius3 + centery3);
-  _y4 = (int)(sin(angle4) * radius4 + centery4);
-
-  for(y=0; y<96; y++) {
-    x1 = sx1; x2 = sx2; x3 = sx3; x4 = sx4;
-    for(x=0; x<64; x++) {
-      value = hueShift
-        + (int8_t)pgm_read_byte(sinetab + (uint8_t)((x1 * x1 + _y1 * _y1) >> 2))
-        + (int8_t)pgm_read_byte(sinetab + (uint8_t)((x2 * x2 + _y2 * _y2) >> 2))
-        + (int8_t)pgm_read_byte(sinetab + (uint8_t)((x3 * x3 + _y3 * _y3) >> 3))
-        + (int8_t)pgm_read_byte(sinetab + (uint8_t)((x4 * x4 + _y4 * _y4) >> 3));
-      matrix.drawPixel(x, y, matrix.ColorHSV(value * 3, 255, 255, true));
-      x1--; x2--; x3--; x4--;
+/*
+* The four centers each go around a circle. Radii and centers are in 16ths of a pixel,
+*   and angles are phases, 65536 to the turn, so that sinetab can stand in for
+*   sin() and cos(). Odd centers go around backwards.
+*/
+const int16_t plasma_radius[4] = { 261,  368,  653,  707 };
+const int16_t plasma_cx[4]     = { 258,  186,  374,   66 };
+const int16_t plasma_cy[4]     = { 139,  104,  224,  -46 };
+uint16_t      plasma_angle[4]  = { 0, 0, 0, 0 };
+int16_t       plasma_speed[4]  = { 0, 0, 0, 0 };
+long          hueShift    = 0;
+int           hue_shift_s = 2;
+
+// The hue wheel, as render buffer patterns. The sum of the four waves indexes it.
+RGBSprite plasma_palette = {0, 0, NULL};
+
+/*
+* The plasma can be rendered at half or quarter resolution, and scaled up. Scale is
+*   log2 of the stride between samples. Coarse samples are kept as raw sums, so that
+*   they can be blended before they go through the palette.
+*/
+#define PLASMA_MAX_SCALE    2        // Quarter resolution.
+#define PLASMA_SCALE_AUTO   0xFF     // Let the frame budget decide.
+#define PLASMA_GRID_ROWS    ((96 >> 1) + 1)   // Enough for half resolution, plus an
+#define PLASMA_GRID_COLS    ((64 >> 1) + 1)   //   edge to blend toward.
+
+uint8_t  plasma_scale     = 0;
+uint8_t  plasma_scale_set = PLASMA_SCALE_AUTO;
+bool     plasma_bilinear  = true;
+uint32_t plasma_avg4      = 0;     // Render time in microseconds, averaged, times 4.
+uint16_t plasma_calm      = 0;     // Frames since the scale last changed.
+uint16_t plasma_backoff   = 16;    // Frames to wait before trying a finer scale.
+bool     plasma_went_finer = false;
+int16_t  plasma_grid[PLASMA_GRID_ROWS][PLASMA_GRID_COLS];
+
+
+void make_plasma_palette() {
+  uint16_t colors[512];
+  for (int i = 0; i < 512; i++) colors[i] = matrix.ColorHSV(i * 3, 255, 255, true);
+  // No hue at full saturation is black, so nothing is transparent.
+  matrix.makeSprite(&plasma_palette, colors, 32, 16, 0);
+}
+
+
+/*
+* Each pixel's value is the sum of sinetab over its squared distance to each center.
+*   Along a row, x steps by one, so each squared distance is carried forward with
+*   (x-1)^2 = x^2 - 2x + 1 rather than multiplied out.
+*/
+void plasma_row(int16_t y, const int16_t* sx, const int16_t* sy, uint32_t* out) {
+  int32_t d[4];    // Squared distance to each center.
+  int32_t dx[4];   // x distance to each center.
+  for (int i = 0; i < 4; i++) {
+    int32_t dy = sy[i] - y;
+    dx[i] = sx[i];
+    d[i]  = (dx[i] * dx[i]) + (dy * dy);
+  }
+  for (int x = 0; x < 64; x++) {
+    int16_t value = sinetab[(uint8_t) (d[0] >> 2)] + sinetab[(uint8_t) (d[1] >> 2)] +
+                    sinetab[(uint8_t) (d[2] >> 3)] + sinetab[(uint8_t) (d[3] >> 3)];
+    out[x] = plasma_palette.px[(hueShift + value) & 511];
+    for (int i = 0; i < 4; i++) {
+      d[i] -= (2 * dx[i]) - 1;
+      dx[i]--;
+    }
+  }
+}
+
+
+/*
+* The same as plasma_row(), but only every (1 << scale)th pixel, into the grid. The
+*   forward difference is then (x-s)^2 = x^2 - 2sx + s^2. One sample past the right
+*   edge is taken, for blending.
+*/
+void plasma_grid_row(int16_t y, uint8_t scale, const int16_t* sx, const int16_t* sy, int16_t* out) {
+  int32_t d[4];
+  int32_t dx[4];
+  const int32_t s2 = 1 << (scale << 1);
+  for (int i = 0; i < 4; i++) {
+    int32_t dy = sy[i] - y;
+    dx[i] = sx[i];
+    d[i]  = (dx[i] * dx[i]) + (dy * dy);
+  }
+  for (int x = 0; x <= (64 >> scale); x++) {
+    out[x] = sinetab[(uint8_t) (d[0] >> 2)] + sinetab[(uint8_t) (d[1] >> 2)] +
+             sinetab[(uint8_t) (d[2] >> 3)] + sinetab[(uint8_t) (d[3] >> 3)];
+    for (int i = 0; i < 4; i++) {
+      d[i] -= (dx[i] << (scale + 1)) - s2;
+      dx[i] -= (1 << scale);
+    }
+  }
+}
+
+
+/*
+* One full-width row of palette entries, scaled up from the grid. Nearest takes the
+*   sample above and to the left. Bilinear blends the four around the pixel.
+*/
+void plasma_upscale(int16_t y, uint8_t scale, uint32_t* out) {
+  const int16_t* top = plasma_grid[y >> scale];
+  const int32_t  s   = 1 << scale;
+  if (!plasma_bilinear) {
+    for (int i = 0; i < (64 >> scale); i++) {
+      uint32_t pattern = plasma_palette.px[(hueShift + top[i]) & 511];
+      for (int k = 0; k < s; k++) *(out++) = pattern;
+    }
+    return;
+  }
+
+  const int16_t* bot = plasma_grid[(y >> scale) + 1];
+  const int32_t  fy  = y & (s - 1);
+  int32_t col[PLASMA_GRID_COLS];   // Blended down the column, times s.
+  for (int i = 0; i <= (64 >> scale); i++) {
+    col[i] = (top[i] * (s - fy)) + (bot[i] * fy);
+  }
+  // Across the row, the blend moves by a constant step between samples.
+  for (int i = 0; i < (64 >> scale); i++) {
+    int32_t value = col[i] << scale;
+    int32_t delta = col[i + 1] - col[i];
+    for (int k = 0; k < s; k++) {
+      *(out++) = plasma_palette.px[(hueShift + (value >> (scale << 1))) & 511];
+      value += delta;
     }
-    _y1--; _y2--; _y3--; _y4--;
   }
+}
+
+
+/*
+* Picks the scale for the next frame. Rendering may take the plasma's budget (as
+*   register_effects() gives it), and the rest of the frame is left for serial
+*   traffic and gestures. Over that, go coarser.
+*   A finer scale costs up to four times as much, so only go finer when there is room
+*   for that. If a finer scale was tried and didn't fit, wait twice as long before
+*   trying it again.
+*/
+void plasma_govern(uint32_t elapsed, uint32_t budget) {
+  plasma_avg4 += elapsed - (plasma_avg4 >> 2);
+  if (PLASMA_SCALE_AUTO != plasma_scale_set) {
+    plasma_scale = plasma_scale_set;
+    return;
+  }
+  if (plasma_calm < 0xFFFF) plasma_calm++;
+  if (plasma_calm < 8) return;   // Let the average catch up with this scale.
+
+  uint32_t avg = plasma_avg4 >> 2;
+  if ((avg > budget) && (plasma_scale < PLASMA_MAX_SCALE)) {
+    if (plasma_went_finer && (plasma_calm < 32) && (plasma_backoff < 4096)) plasma_backoff <<= 1;
+    plasma_went_finer = false;
+    plasma_scale++;
+    plasma_calm = 0;
+  }
+  else if (((avg << 2) <= budget) && (plasma_scale > 0) && (plasma_calm >= plasma_backoff)) {
+    plasma_went_finer = true;
+    plasma_scale--;
+    plasma_calm = 0;
+  }
+}
+
+
+/*
+* A frame is made in slices, so that input can be serviced while it is drawn (see
+*   Effect.h). plasma_begin() fixes the centers and scale for the frame. Each
+*   plasma_slice() then does units of work until the slice ends: the grid rows
+*   first, if the frame is scaled, and then the row pairs.
+* Rows are made in the pairs that share bytes in the render buffer, so that each
+*   byte is written whole.
+*/
+#define PLASMA_ROW_PAIRS   48
+
+int16_t  plasma_sx[4];
+int16_t  plasma_sy[4];
+uint8_t  plasma_frame_scale = 0;
+uint8_t  plasma_next        = 0;   // The next unit of work.
+uint32_t plasma_spent       = 0;   // On this frame so far, in microseconds.
+
+
+void plasma_begin() {
+  for (int i = 0; i < 4; i++) {
+    uint8_t phase = plasma_angle[i] >> 8;
+    plasma_sx[i] = ((((int32_t) sinetab[(uint8_t) (phase + 64)] * plasma_radius[i]) / 127) + plasma_cx[i]) / 16;
+    plasma_sy[i] = ((((int32_t) sinetab[phase] * plasma_radius[i]) / 127) + plasma_cy[i]) / 16;
+  }
+  plasma_frame_scale = plasma_scale;
+  plasma_next  = 0;
+  plasma_spent = 0;
+}
 
-    angle1 += angle1_s;
-    angle2 -= angle2_s;
-    angle3 += angle3_s;
-    angle4 -= angle4_s;
+
+// True once the frame is done. budget is how long the whole frame may take.
+bool plasma_slice(uint32_t slice_end, uint32_t budget) {
+  LuxProfTimer prof(&profiler, prof_plasma);
+  uint32_t upper[64];
+  uint32_t lower[64];
+  if (NULL == plasma_palette.px) return true;
+  uint32_t t0 = micros();
+  uint8_t  scale = plasma_frame_scale;
+  uint8_t  grid_rows = scale ? ((96 >> scale) + 1) : 0;
+  bool     done = false;
+
+  do {
+    if (plasma_next < grid_rows) {
+      plasma_grid_row(plasma_next << scale, scale, plasma_sx, plasma_sy, plasma_grid[plasma_next]);
+    }
+    else {
+      uint8_t pair = plasma_next - grid_rows;
+      int16_t y    = ((pair >> 4) << 5) + (pair & 0x0F);   // The upper row of the pair.
+      if (scale) {
+        plasma_upscale(y,      scale, upper);
+        plasma_upscale(y + 16, scale, lower);
+      }
+      else {
+        plasma_row(y,      plasma_sx, plasma_sy, upper);
+        plasma_row(y + 16, plasma_sx, plasma_sy, lower);
+      }
+      LuxProfTimer prof_r(&profiler, prof_rows);
+      matrix.drawPatternRows(y, upper, lower);
+    }
+    plasma_next++;
+    done = (plasma_next >= (grid_rows + PLASMA_ROW_PAIRS));
+  } while (!done && ((int32_t) (micros() - slice_end) < 0));
+
+  plasma_spent += micros() - t0;
+  if (done) {
+    for (int i = 0; i < 4; i++) {
+      plasma_angle[i] += (i & 1) ? -plasma_speed[i] : plasma_speed[i];
+    }
     hueShift += hue_shift_s;
+    plasma_govern(plasma_spent, budget);
+  }
+  return done;
 }
 
 
@@ -210,127 +515,233 @@ void advance_plasma() {
 *  //of the array is 52 x 102.  The reason for this is to make the 
 *  //calculations easier for the cells on the outermost "frame" of the grid.
 *****************************************************************************************/
-//Copies one array to another.
-void copy(int array1[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH], int array2[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH]) {
-  for(int j = 0; j < GOL_BOARD_HEIGHT; j++) {
-    for(int i = 0; i < GOL_BOARD_WIDTH; i++) {
-      array2[j][i] = array1[j][i];
-    }
+// The board is bit-packed. See GoLBoard.h. The old int[64][96] boards (three of them)
+//   cost 72KB. The board is now a 512x512 universe, which costs 64KB, and the panel
+//   is a window onto it. Any Life-like rule will run. See LifeRule.h.
+GoLBoard gol;
+
+// Panel x runs down the board's rows, and panel y along its columns. At zoom z, each
+//   pixel stands for a square of cells (1 << z) on a side, and shows how crowded it is.
+#define GOL_VIEW_ROWS    64
+#define GOL_VIEW_COLS    96
+#define GOL_MAX_ZOOM      3
+
+uint16_t gol_view_row = (GOL_BOARD_HEIGHT - GOL_VIEW_ROWS) / 2;   // The cell at the panel's origin.
+uint16_t gol_view_col = (GOL_BOARD_WIDTH  - GOL_VIEW_COLS) / 2;
+uint8_t  gol_zoom     = 0;
+
+
+uint16_t gol_color = 0x00CC;
+
+// The things a pixel can look like. The first four are indexed by
+//   ((alive << 1) | was_alive). Under Generations rules, dying cells fade out
+//   through the next few, by age. Zoomed out, pixels take one of the density looks.
+//   These are 1x1 sprites so that drawing a pixel is only the plane writes.
+#define GOL_LOOK_FADE     4
+#define GOL_LOOK_DENSITY  (GOL_LOOK_FADE + LIFE_MAX_STATES - 2)
+#define GOL_LOOK_COUNT    (GOL_LOOK_DENSITY + 3)
+#define GOL_LOOK_NONE     0xFF    // Something else is on the panel here.
+RGBSprite gol_looks[GOL_LOOK_COUNT];
+
+// What the panel is showing, as of the last print.
+uint8_t  gol_shown[GOL_VIEW_ROWS][GOL_VIEW_COLS];
+uint64_t gol_stale = 0;   // Panel rows to re-encode even if the board didn't change under them.
+uint32_t gol_cells_drawn = 0;
+
+
+void make_gol_sprites() {
+  const uint16_t looks[GOL_LOOK_COUNT] = {
+    0, 0xC000, 0x0617, gol_color,                  // Cells
+    0xC000, 0xA000, 0x8000, 0x6000, 0x4000, 0x2000,   // Fades
+    0x0044, 0x0088, gol_color                      // Densities
+  };
+  for (int i = 0; i < GOL_LOOK_COUNT; i++) {
+    matrix.makeSprite(&gol_looks[i], &looks[i], 1, 1, 0xFFFF);   // Nothing is transparent.
   }
 }
 
-//The life function is the most important function in the program.
-//It counts the number of cells surrounding the center cell, and 
-//determines whether it lives, dies, or stays the same.
-void life(int array[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH], char choice)
-{
-  //Copies the main array to a temp array so changes can be entered into a grid
-  //without effecting the other cells and the calculations being performed on them.
-  int temp[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH];
-  copy(array, temp);
-  for(int j = GOL_BOARD_HEIGHT; j < (GOL_BOARD_HEIGHT*2); j++) {
-    for(int i = GOL_BOARD_WIDTH; i < (GOL_BOARD_WIDTH*2); i++) {
-      if(choice == 'm') {
-        //The Moore neighborhood checks all 8 cells surrounding the current cell in the array.
-        int count = 0;
-        count = array[(j-1)%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] + 
-	  array[(j-1)%GOL_BOARD_HEIGHT][(i-1) % GOL_BOARD_WIDTH] +
-	  array[j%GOL_BOARD_HEIGHT][(i-1) % GOL_BOARD_WIDTH] +
-	  array[(j+1)%GOL_BOARD_HEIGHT][(i-1) % GOL_BOARD_WIDTH] +
-	  array[(j+1)%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] +
-	  array[(j+1)%GOL_BOARD_HEIGHT][(i+1) % GOL_BOARD_WIDTH] +
-	  array[j%GOL_BOARD_HEIGHT][(i+1) % GOL_BOARD_WIDTH] +
-          array[(j-1)%GOL_BOARD_HEIGHT][(i+1) % GOL_BOARD_WIDTH];
-
-        if(count < 2 || count > 3) temp[j%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] = 0;  //The cell dies.
-        else if(count == 2) temp[j%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] = array[j%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH];  //The cell stays the same.
-        else if(count == 3) temp[j%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] = 1;  //The cell either stays alive, or is "born".
-      }
 
-      else if(choice == 'v') {
-        //The Von Neumann neighborhood checks only the 4 surrounding cells in the array,
-        //(N, S, E, and W).
-        int count = 0;
-        count = array[(j-1)%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] +
-          array[j%GOL_BOARD_HEIGHT][(i-1) % GOL_BOARD_WIDTH] +
-          array[(j+1)%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] +
-          array[j%GOL_BOARD_HEIGHT][(i+1) % GOL_BOARD_WIDTH];  
-          
-        if(count < 2 || count > 3) temp[j%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] = 0; //The cell dies.
-        else if(count == 2) temp[j%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] = array[j%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH];    //The cell stays the same.
-        else if(count == 3) temp[j%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] = 1;   //The cell either stays alive, or is "born".
-      }        
+// Forget what is drawn in this part of the panel, so that the next print covers it.
+void gol_invalidate(int16_t x, int16_t y, uint8_t w, uint8_t h) {
+  for (int16_t i = x; i < (x + w); i++) {
+    if ((i < 0) || (i >= GOL_VIEW_ROWS)) continue;
+    for (int16_t j = y; j < (y + h); j++) {
+      if ((j >= 0) && (j < GOL_VIEW_COLS)) gol_shown[i][j] = GOL_LOOK_NONE;
     }
-   }
-  //Copies the completed temp array back to the main array.
-  copy(temp, array);
-}
-
-//Checks to see if two arrays are exactly the same. 
-//This is used to end the simulation early, if it 
-//becomes stable before the 100th generation. This
-//occurs fairly often in the Von Neumann neighborhood,
-//but almost never in the Moore neighborhood.
-bool compare(int array1[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH], int array2[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH]) {
-  int count = 0;
-  for(int j = 0; j < GOL_BOARD_HEIGHT; j++) {
-    for(int i = 0; i < GOL_BOARD_WIDTH; i++) {
-      if(array1[j][i]==array2[j][i]) {
-        count++;
-      }
+    gol_stale |= (1ULL << i);
+  }
+}
+
+
+// The board cell under the top-left corner of a panel pixel.
+inline uint16_t gol_row_at(uint8_t x) {   return (gol_view_row + ((uint16_t) x << gol_zoom)) % GOL_BOARD_HEIGHT;   }
+inline uint16_t gol_col_at(uint8_t y) {   return (gol_view_col + ((uint16_t) y << gol_zoom)) % GOL_BOARD_WIDTH;    }
+
+
+// Move the window by some number of pixels.
+void gol_pan(int16_t dx, int16_t dy) {
+  int32_t r = ((int32_t) gol_view_row + ((int32_t) dx << gol_zoom)) % GOL_BOARD_HEIGHT;
+  int32_t c = ((int32_t) gol_view_col + ((int32_t) dy << gol_zoom)) % GOL_BOARD_WIDTH;
+  gol_view_row = (r < 0) ? (r + GOL_BOARD_HEIGHT) : r;
+  gol_view_col = (c < 0) ? (c + GOL_BOARD_WIDTH)  : c;
+  gol_invalidate(0, 0, GOL_VIEW_ROWS, GOL_VIEW_COLS);
+}
+
+
+// Zoom about the middle of the panel.
+void gol_set_zoom(int8_t z) {
+  if ((z < 0) || (z > GOL_MAX_ZOOM) || (z == gol_zoom)) return;
+  uint16_t mid_r = gol_row_at(GOL_VIEW_ROWS / 2);
+  uint16_t mid_c = gol_col_at(GOL_VIEW_COLS / 2);
+  gol_zoom = z;
+  gol_view_row = (mid_r + GOL_BOARD_HEIGHT - (((GOL_VIEW_ROWS / 2) << z) % GOL_BOARD_HEIGHT)) % GOL_BOARD_HEIGHT;
+  gol_view_col = (mid_c + GOL_BOARD_WIDTH  - (((GOL_VIEW_COLS / 2) << z) % GOL_BOARD_WIDTH))  % GOL_BOARD_WIDTH;
+  gol_invalidate(0, 0, GOL_VIEW_ROWS, GOL_VIEW_COLS);
+}
+
+
+// Bring to life every cell under a panel pixel.
+void gol_set_at(uint8_t x, uint8_t y) {
+  for (uint8_t i = 0; i < (1 << gol_zoom); i++) {
+    for (uint8_t j = 0; j < (1 << gol_zoom); j++) {
+      gol.set((gol_row_at(x) + i) % GOL_BOARD_HEIGHT, (gol_col_at(y) + j) % GOL_BOARD_WIDTH);
     }
   }
-  //Since the count gets incremented every time the cells are exactly the same,
-  //an easy way to check if the two arrays are equal is to compare the count to 
-  //the dimensions of the array multiplied together.
-  if(count == GOL_BOARD_HEIGHT*GOL_BOARD_WIDTH)
-    return true;
-  else
-    return false;
 }
 
 
-uint16_t gol_color = 0x00CC;
+uint8_t gol_look(GoLBoard* board, uint8_t x, uint8_t y) {
+  uint16_t r = gol_row_at(x);
+  uint16_t c = gol_col_at(y);
+  if (0 == gol_zoom) {
+    uint8_t a = board->age(r, c);
+    if (a) return (GOL_LOOK_FADE + a - 1);
+    return ((board->alive(r, c) << 1) | board->wasAlive(r, c));
+  }
+  uint8_t live = 0;
+  for (uint8_t i = 0; i < (1 << gol_zoom); i++) {
+    live += __builtin_popcount(board->span((r + i) % GOL_BOARD_HEIGHT, c, 1 << gol_zoom));
+  }
+  if (0 == live) return 0;
+  return (GOL_LOOK_DENSITY + (((live - 1) * 3) >> (gol_zoom << 1)));
+}
 
 
-//This function prints the 50 x 100 part of the array, since that's the only
-//portion of the array that we're really interested in. 
-void print(int array[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH], int bu[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH]) {
-  for(int j = 0; j < GOL_BOARD_HEIGHT; j++) {
-    for(int i = 0; i < GOL_BOARD_WIDTH; i++) {
-      if(array[j][i] == 1) {
-        matrix.drawPixel(j, i, (bu[j][i]) ? gol_color : 0x0617);
-      }
-      else {
-        matrix.drawPixel(j, i, (bu[j][i]) ? 0xC000 : 0);
+//This function prints only the pixels whose look differs from what is already on
+//  the panel. Only the part of the board under the window is looked at, and only
+//  the rows of it where the board flagged a change. It can be done in bands of panel
+//  rows, and gol_print_done() called after the last of them.
+void gol_print_rows(GoLBoard* board, uint8_t x0, uint8_t x1) {
+  LuxProfTimer prof(&profiler, prof_print);
+  // The words of a board row that the window covers.
+  uint32_t words = 0;
+  uint16_t span  = GOL_VIEW_COLS << gol_zoom;
+  if (span > GOL_BOARD_WIDTH) span = GOL_BOARD_WIDTH;
+  for (uint16_t i = 0; i < span; i += 32) words |= 1UL << (((gol_view_col + i) % GOL_BOARD_WIDTH) >> 5);
+  words |= 1UL << (((gol_view_col + span - 1) % GOL_BOARD_WIDTH) >> 5);
+
+  if (x1 > GOL_VIEW_ROWS) x1 = GOL_VIEW_ROWS;
+  for (uint8_t x = x0; x < x1; x++) {
+    bool dirty = (gol_stale >> x) & 1;
+    gol_stale &= ~(1ULL << x);
+    for (uint8_t i = 0; (i < (1 << gol_zoom)) && !dirty; i++) {
+      dirty = (0 != (board->dirtyWords((gol_row_at(x) + i) % GOL_BOARD_HEIGHT) & words));
+    }
+    if (!dirty) continue;
+    for (uint8_t y = 0; y < GOL_VIEW_COLS; y++) {
+      uint8_t look = gol_look(board, x, y);
+      if (look != gol_shown[x][y]) {
+        matrix.drawSprite(&gol_looks[look], x, y);
+        gol_shown[x][y] = look;
+        gol_cells_drawn++;
       }
     }
   }
 }
 
-// Local scope stuff to migrate.
-  int gen0[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH];
-  int todo[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH];
-  int backup[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH];
-  char neighborhood = 'm';
-  char cont;
+
+void gol_print_done(GoLBoard* board) {
+  board->clearRedraw();
+}
+
+
+void print(GoLBoard* board) {
+  gol_print_rows(board, 0, GOL_VIEW_ROWS);
+  gol_print_done(board);
+}
 
 
 void generate_random_gol_state() {
-  srand(micros());
-  for(int j = 1; j < GOL_BOARD_HEIGHT-1; j++) {
-    for (int i = 1; i < GOL_BOARD_WIDTH-1; i++) {
-      gen0[j][i] = rand() % 2;
-    }
+  if (!trace_replaying) srand(micros());   // A replay has to come out the same every time.
+  gol.randomize();
+}
+
+
+// Switch the board to one of the built-in rules. The board is left as it was.
+uint8_t gol_rule_idx = 0;
+
+int8_t set_gol_rule(uint8_t idx) {
+  LifeRule rule;
+  if ((idx >= LIFE_RULE_COUNT) || rule.parse(LIFE_RULE_LIST[idx])) return -1;
+  gol_rule_idx = idx;
+  gol.setRule(&rule);
+  return 0;
+}
+
+// Switch to the next of them, and reseed.
+void next_gol_rule() {
+  if (0 == set_gol_rule((gol_rule_idx + 1) % LIFE_RULE_COUNT)) {
+    generate_random_gol_state();
   }
-  copy(gen0, todo);
 }
 
 
 
-void advance_gol_states() {
-  copy(todo, backup);
-  life(todo, neighborhood);
+// Skipping ahead. The node pool is only allocated the first time it's wanted.
+// A board that is still busy can need more nodes at once than the pool has, even
+//   collecting as it goes (see host/hashlife_bench.cpp). Then the generations are
+//   stepped off the plain way instead, a few on top of each frame's own.
+#define GOL_JUMP_LOG2       10   // 1024 generations.
+#define GOL_SKIP_PER_FRAME  32
+HashLife gol_hashlife;
+uint32_t gol_jump_micros = 0;   // How long the last jump took.
+uint32_t gol_skip_gens   = 0;   // Generations owed by a jump HashLife couldn't do.
+
+void jump_gol_states() {
+  int8_t ret = -3;
+  if (gol_hashlife.ready() || (0 == gol_hashlife.init())) {
+    uint32_t t0 = micros();
+    ret = gol_hashlife.jump(&gol, GOL_JUMP_LOG2);
+    gol_jump_micros = micros() - t0;
+  }
+  if (ret) {
+    // The board is as it was.
+    gol_skip_gens = (uint32_t) 1 << GOL_JUMP_LOG2;
+    Serial.print("HashLife couldn't jump (");
+    Serial.print(ret);
+    Serial.println("). Stepping instead.");
+  }
+}
+
+
+// How long to let a board sit in a cycle before we give up on it and reseed.
+#define GOL_CYCLE_GRACE  120
+uint16_t gol_cycle_gens = 0;
+
+// Steps some columns of the board. True once the generation is done.
+bool advance_gol_states(uint8_t words) {
+  LuxProfTimer prof(&profiler, prof_life);
+  if (!gol.stepSome(words)) return false;
+  if (gol.period()) {
+    if (++gol_cycle_gens > GOL_CYCLE_GRACE) {
+      gol_cycle_gens = 0;
+      generate_random_gol_state();
+    }
+  }
+  else {
+    gol_cycle_gens = 0;
+  }
+  return true;
 }
 
 
@@ -338,163 +749,966 @@ void advance_gol_states() {
 *** Setup and Loop
 *****************************************************************************************/
 
-StringBuilder ipak_rx;
+LineRing ipak_rx;     // Lines of text from the e-field box.
+GestureQueue gestures;   // What came of them, waiting for the next frame.
+PositionFilter pos_filter;
+
+// Filter gains for the console to cycle through, as (alpha, beta). The first is no filter.
+const uint16_t pos_filter_presets[][2] = { {256, 0}, {192, 96}, {POSITION_FILTER_ALPHA, POSITION_FILTER_BETA}, {96, 24} };
+uint8_t pos_filter_preset = 2;
 uint8_t priorx = 0;
 uint8_t priory = 0;
 uint8_t currentx = 0;
 uint8_t currenty = 0;
 uint16_t currentc = 0x020F;
 
-uint8_t mode = 6;
+const char* logo_list[] = {chipkit_logo, microchip_logo, mpide_logo, manuvr_logo};
 
-// TODO: Replace these with the Scheduler.
-uint32_t time_until_action = 9001;
-uint32_t action_time_marker = 9001;
-  
 
-float* target_data = &angle1_s;
+/*****************************************************************************************
+* Effects
+******************************************************************************************
+* Each thing that can own the panel is an Effect (see Effect.h). The ids are the old
+*   mode numbers, so that the serial console still picks them with a digit.
+*****************************************************************************************/
+#define EFFECT_PIXEL_RUN    1
+#define EFFECT_PLASMA       2
+#define EFFECT_PAINT        3
+#define EFFECT_GOL          4
+#define EFFECT_REMOTE       7
+#define EFFECT_ANIMATION    8
+#define EFFECT_LOGOS        9
+
+EffectRegistry effects;
+
+
+// For debugging things.
+class PixelRunEffect : public Effect {
+  public:
+    PixelRunEffect() : Effect("Pixel run") {   _px = 0;  _color = 0;   };
+
+    bool render(uint32_t /* slice_end_us */) {
+      matrix.drawPixel(_px % 64, (_px / 64) % 96, _color);
+      _px++;
+      if (_px % 16 == 15) _color = (uint16_t) random(millis());
+      return true;
+    };
+
+  private:
+    uint16_t _px;
+    uint16_t _color;
+};
 
 
-uint8_t noise_data_select = 0;
+// Position steers one of the centers, and the hue. A tap picks which center.
+class PlasmaEffect : public Effect {
+  public:
+    PlasmaEffect() : Effect("Plasma") {   _target = 0;   };
+
+    void begin() {
+      memset(plasma_speed, 0, sizeof(plasma_speed));
+    };
+
+    void step(uint32_t /* now_ms */) {
+      plasma_begin();
+    };
+
+    bool render(uint32_t slice_end_us) {
+      return plasma_slice(slice_end_us, budget_us);
+    };
+
+    bool onGesture(const LuxGesture* g) {
+      switch (g->kind) {
+        case GESTURE_POSITION:
+          plasma_speed[_target] = (((int16_t) g->pos[1]) - 32768) / 320;   // Phase per frame.
+          hue_shift_s = (int) (g->pos[2] - 32768) / 3277;
+          return true;
+        case GESTURE_TAP:
+          _target = (_target + 1) % 4;
+          return true;
+      }
+      return false;
+    };
 
+  private:
+    uint8_t _target;   // The center that position steers.
+};
+
+
+// Paints with the cursor. A tap leaves a dot behind, in the color given by z.
+class PaintEffect : public Effect {
+  public:
+    PaintEffect() : Effect("Paint") {};
+
+    bool render(uint32_t /* slice_end_us */) {   return true;   };   // Drawing happens as the hand moves.
+
+    bool onGesture(const LuxGesture* g) {
+      switch (g->kind) {
+        case GESTURE_POSITION:
+          if ((priorx != currentx) || (priory != currenty)) {
+            draw_cursor(priorx, priory, 0);
+            draw_cursor(currentx, currenty, currentc);
+          }
+          return true;
+        case GESTURE_TAP:
+          matrix.drawPixel(currentx, currenty, matrix.ColorHSV(currentc * 3, 255, 255, true));
+          return true;
+      }
+      return false;
+    };
+};
+
+
+/*
+* Moving a hand over the board brings cells to life. Touching pauses the board, and
+*   drags the window around. The airwheel zooms, and a double tap jumps ahead.
+* A frame is a generation (or a few, if a jump is being stepped off), a few columns
+*   of words at a time, and then the window, a band of panel rows at a time.
+*/
+#define GOL_SLICE_WORDS   2
+#define GOL_SLICE_ROWS    4
+
+class GoLEffect : public Effect {
+  public:
+    GoLEffect() : Effect("GoL") {
+      _paused       = false;
+      _stepping     = false;
+      _gens         = 0;
+      _row          = 0;
+      _wheel_prior  = 0;
+      _wheel_travel = 0;
+    };
+
+    // Only the pixels that changed get drawn, so start over with the whole window.
+    void begin() {
+      _paused = false;
+      gol_invalidate(0, 0, GOL_VIEW_ROWS, GOL_VIEW_COLS);
+    };
+
+    void step(uint32_t /* now_ms */) {
+      _stepping = !_paused;
+      _gens     = 0;
+      _row      = 0;
+      if (_stepping) {
+        _gens = (gol_skip_gens > GOL_SKIP_PER_FRAME) ? GOL_SKIP_PER_FRAME : gol_skip_gens;
+        gol_skip_gens -= _gens;
+        _gens++;
+      }
+    };
+
+    bool render(uint32_t slice_end_us) {
+      do {
+        if (_stepping) {
+          if (advance_gol_states(GOL_SLICE_WORDS)) _stepping = (--_gens > 0);
+        }
+        else {
+          gol_print_rows(&gol, _row, _row + GOL_SLICE_ROWS);
+          _row += GOL_SLICE_ROWS;
+          if (_row >= GOL_VIEW_ROWS) {
+            gol_print_done(&gol);
+            // The board was just redrawn beneath the cursor. Putting it back is cheap.
+            matrix.drawSprite(&cursor_sprite, currentx-2, currenty-2);
+            return true;
+          }
+        }
+      } while ((int32_t) (micros() - slice_end_us) < 0);
+      return false;
+    };
+
+    bool onGesture(const LuxGesture* g) {
+      switch (g->kind) {
+        case GESTURE_POSITION:
+          if (_paused) {
+            if ((priorx != currentx) || (priory != currenty)) {
+              gol_pan(priorx - currentx, priory - currenty);
+            }
+          }
+          else {
+            if ((priorx != currentx) || (priory != currenty)) {
+              // The board goes back where the cursor was on the next print, and
+              //   the cursor is drawn over it.
+              gol_invalidate(priorx-2, priory-2, 5, 5);
+            }
+            gol_set_at(currentx, currenty);
+          }
+          return true;
+
+        case GESTURE_AIRWHEEL:
+          {
+            // The wheel reports its angle in 32 steps. A quarter turn is a zoom step.
+            int delta = ((g->value - _wheel_prior + 48) % 32) - 16;
+            if (_wheel_prior) _wheel_travel += delta;   // The first report is only a reference.
+            _wheel_prior = g->value;
+            if (_wheel_travel >= 8) {
+              gol_set_zoom(gol_zoom - 1);
+              _wheel_travel = 0;
+            }
+            else if (_wheel_travel <= -8) {
+              gol_set_zoom(gol_zoom + 1);
+              _wheel_travel = 0;
+            }
+          }
+          return true;
+
+        case GESTURE_DOUBLE_TAP:
+          jump_gol_states();
+          return true;
+
+        case GESTURE_TOUCH:
+          _paused = (0 != g->value);
+          return true;
+      }
+      return false;
+    };
+
+  private:
+    bool    _paused;
+    bool    _stepping;   // Still on the generations. Then on the window...
+    uint8_t _gens;       // Generations left to step this frame.
+    uint8_t _row;        // ...from this panel row.
+    int     _wheel_prior;
+    int  _wheel_travel;   // Since the last zoom step.
+};
+
+
+// Frames pushed by a remote host are drawn as they arrive. This only holds the panel.
+class RemoteFrameEffect : public Effect {
+  public:
+    RemoteFrameEffect() : Effect("Remote") {};
+    bool render(uint32_t /* slice_end_us */) {   return true;   };
+};
+
+
+// Only the tiles that changed get drawn, a slice at a time. Between frames, the slices
+//   go to reading the stream ahead, a sector at a time. One source plays at a time:
+//   whatever play_animation() loaded, or else the card's. Neither is held open once
+//   something else has the panel.
+class AnimationEffect : public Effect {
+  public:
+    AnimationEffect() : Effect("Animation") {   _now = 0;   };
+
+    bool available() {   return (animation.loaded() || anim_stream.loaded() || anim_on_card);   };
+
+    void begin() {
+      if (!animation.loaded() && !anim_stream.loaded()) open_anim_stream();
+    };
+
+    void end() {
+      animation.unload();
+      close_anim_stream();
+    };
+
+    void step(uint32_t now_ms) {   _now = now_ms;   };
+
+    bool render(uint32_t slice_end_us) {
+      if (animation.loaded()) {
+        animation.service(_now, slice_end_us);
+        return !animation.decoding();
+      }
+      anim_stream.service(_now, slice_end_us);
+      if (anim_stream.decoding()) return false;
+      return !anim_stream.readAhead();
+    };
+
+  private:
+    uint32_t _now;
+};
+
+
+/*
+* Cycles through the logos, when the scheduler says to. A tap skips ahead.
+* Each logo is written twice, as set_logo() always was, a few columns at a time.
+*/
+#define LOGO_SLICE_COLS   4
+
+class LogoEffect : public Effect {
+  public:
+    LogoEffect() : Effect("Logos") {
+      _up  = 3;
+      _due = false;
+      _col = 0;
+    };
+
+    // Show one right away, and then on the rotation.
+    void begin() {
+      _due = true;
+      _col = 0;
+      scheduler.enableSchedule(pid_logo_rotate, micros());
+    };
+    void end() {       scheduler.disableSchedule(pid_logo_rotate);   };
+    void skip() {      _due = true;   };
+    void rewind() {    _up = 0;       };
+
+    bool render(uint32_t slice_end_us) {
+      if (!_due) return true;
+      do {
+        set_logo_columns(logo_list[_up % 4], _col % 64, (_col % 64) + LOGO_SLICE_COLS);
+        _col += LOGO_SLICE_COLS;
+        if (_col >= 128) {
+          _col = 0;
+          _up++;
+          _due = false;
+          return true;
+        }
+      } while ((int32_t) (micros() - slice_end_us) < 0);
+      return false;
+    };
+
+    bool onGesture(const LuxGesture* g) {
+      if (GESTURE_TAP != g->kind) return false;
+      skip();
+      scheduler.delaySchedule(pid_logo_rotate, micros());
+      return true;
+    };
+
+  private:
+    uint8_t  _up;
+    bool     _due;      // Show the next one...
+    uint8_t  _col;      // ...from here. Two passes of 64 columns.
+};
+
+
+PixelRunEffect    pixel_run_effect;
+PlasmaEffect      plasma_effect;
+PaintEffect       paint_effect;
+GoLEffect         gol_effect;
+RemoteFrameEffect remote_effect;
+AnimationEffect   animation_effect;
+LogoEffect        logo_effect;
+
+
+/*
+* Swipes move through these in the order they're added. Budgets are per frame. The
+*   logos cost a lot, but only once every few seconds, so they aren't held to one.
+*   Nothing moves on them between those times, so they don't need many frames. Paint
+*   is cheap, and is held to short frames so the brush keeps up with the hand.
+*/
+void register_effects() {
+  effects.add(EFFECT_PIXEL_RUN, &pixel_run_effect, 1000, false);
+  effects.add(EFFECT_PLASMA,    &plasma_effect,    5000, true,  8000,  40000);
+  effects.add(EFFECT_PAINT,     &paint_effect,     1000, true,  10000, 20000);
+  effects.add(EFFECT_GOL,       &gol_effect,       6000, true,  10000, 100000);
+  effects.add(EFFECT_LOGOS,     &logo_effect,      0,    true,  50000, 200000);
+  effects.add(EFFECT_ANIMATION, &animation_effect, 5000, true);
+  effects.add(EFFECT_REMOTE,    &remote_effect,    0,    false);
+}
+
+
+/*****************************************************************************************
+*** Gesture traces
+******************************************************************************************
+* Recording logs every line from the e-field box, with its time, to the card. Replaying
+*   feeds a recorded trace back through the parser, and reports on each frame that
+*   comes of it: how long it took to render, how long its input waited to be drawn,
+*   and a checksum of the render buffer. See LuxTrace.h for the file format.
+*
+* A replay is run in lockstep on the trace's clock. Each frame takes the lines stamped
+*   up to its start, on the recorded frame period, and the next frame doesn't start
+*   until this one is drawn. Nothing is skipped for being over budget, the plasma
+*   stays at one scale, and the GoL board starts from the same seed. So two replays of
+*   a trace put the same pixels on the panel, frame for frame, whatever they cost, and
+*   only the timing in the report should differ. The frame job can run faster than
+*   recorded, to get through a trace sooner. The output is the same.
+*****************************************************************************************/
+
+int8_t process_string_from_counterparty(const char*, uint16_t, uint32_t);
+void   note_interaction();
+
+TraceWriter trace_out;            // The trace being recorded, or the report of a replay.
+TraceReader trace_in;             // The trace being replayed.
+uint32_t trace_t0         = 0;    // micros() when the recording started.
+uint32_t trace_frame      = 0;    // Frames of the replay started so far.
+uint32_t trace_frame_us   = 0;    // As recorded. The replay's clock runs on this.
+uint32_t trace_frame_input = 0;   // Oldest input behind the frame being drawn...
+bool     trace_frame_had_input = false;   // ...if there was any.
+uint32_t trace_frames_done = 0;   // effects.frames_done, as of the last frame reported.
+bool     trace_pending    = false;   // We have a line from the trace that isn't due yet.
+uint32_t trace_pending_us = 0;
+const char* trace_pending_line = NULL;
+uint16_t trace_pending_len = 0;
+
+/* The settings from before the replay, to put back after. */
+uint8_t  trace_plasma_scale = PLASMA_SCALE_AUTO;
+uint8_t  trace_gol_rule     = 0;
+uint8_t  trace_scan_order   = 0;
+bool     trace_bilinear     = true;
+uint16_t trace_filter_alpha = POSITION_FILTER_ALPHA;
+uint16_t trace_filter_beta  = POSITION_FILTER_BETA;
+
+/* Replay stats */
+uint32_t trace_frames     = 0;
+uint32_t trace_render_sum = 0;
+uint32_t trace_render_max = 0;
+uint32_t trace_latency_sum = 0;
+uint32_t trace_latency_max = 0;
+uint32_t trace_latency_n  = 0;
+uint32_t trace_sum        = 0;    // The buffer checksums of every frame, chained.
+
+
+void trace_record_begin() {
+  if (trace_replaying) return;
+  if (trace_out.open(TRACE_PATH)) {
+    Serial.println("Couldn't open " TRACE_PATH);
+    return;
+  }
+  trace_out.concatf("# murumlux-trace %u effect %u frame %u rule %u order %u fill %u filter %u %u\n",
+    TRACE_VERSION, effects.currentId(), frame_period_us,
+    gol_rule_idx, matrix.scanOrder(), plasma_bilinear ? 1 : 0, pos_filter.alpha(), pos_filter.beta()
+  );
+  trace_t0 = micros();
+  trace_recording = true;
+  Serial.println("Recording to " TRACE_PATH);
+}
+
+
+void trace_record(const char* line, uint16_t len, uint32_t now_us) {
+  trace_out.concatf("%u ", now_us - trace_t0);
+  trace_out.write(line, len);
+  trace_out.write("\n", 1);
+}
+
+
+void trace_record_end() {
+  trace_out.close();
+  trace_recording = false;
+  Serial.print("Recorded bytes: ");
+  Serial.println(trace_out.bytes);
+}
+
+
+/*
+* speed is how many times faster than recorded to run the frames.
+*/
+void trace_replay_begin(uint8_t speed) {
+  if (trace_recording) trace_record_end();
+  if (trace_replaying || (0 == speed)) return;
+  if (trace_in.open(TRACE_PATH)) {
+    Serial.println("No trace at " TRACE_PATH);
+    return;
+  }
+  trace_out.open(TRACE_REPORT_PATH);
+  trace_out.concatf("# frame render_us latency_us checksum\n");
+
+  // The settings it was recorded under. An old trace didn't keep them.
+  trace_plasma_scale = plasma_scale_set;
+  trace_gol_rule     = gol_rule_idx;
+  trace_scan_order   = matrix.scanOrder();
+  trace_bilinear     = plasma_bilinear;
+  trace_filter_alpha = pos_filter.alpha();
+  trace_filter_beta  = pos_filter.beta();
+  if (trace_in.settings) {
+    set_gol_rule(trace_in.gol_rule);
+    matrix.setScanOrder(trace_in.scan_order);
+    plasma_bilinear = trace_in.plasma_bilinear;
+    pos_filter.setGains(trace_in.filter_alpha, trace_in.filter_beta);
+  }
+
+  // Everything the trace can steer goes back to where it starts.
+  srand(TRACE_SEED);
+  gol.randomize();
+  gol_view_row = (GOL_BOARD_HEIGHT - GOL_VIEW_ROWS) / 2;
+  gol_view_col = (GOL_BOARD_WIDTH  - GOL_VIEW_COLS) / 2;
+  gol_zoom     = 0;
+  gol_skip_gens = 0;
+  for (uint8_t i = 0; i < 4; i++) {
+    plasma_angle[i] = 0;
+    plasma_speed[i] = 0;
+  }
+  hueShift    = 0;
+  hue_shift_s = 2;
+  plasma_scale_set   = (PLASMA_SCALE_AUTO == plasma_scale_set) ? 0 : plasma_scale_set;
+  priorx   = 0;
+  priory   = 0;
+  currentx = 0;
+  currenty = 0;
+  currentc = 0x020F;
+  pos_filter.reset();
+  LuxGesture g;
+  while (gestures.take(&g)) {}
+
+  trace_frame       = 0;
+  trace_frame_us    = trace_in.frame_us;
+  trace_frame_had_input = false;
+  trace_pending     = false;
+  trace_frames      = 0;
+  trace_render_sum  = 0;
+  trace_render_max  = 0;
+  trace_latency_sum = 0;
+  trace_latency_max = 0;
+  trace_latency_n   = 0;
+  trace_sum         = 2166136261UL;
+
+  trace_replaying = true;
+  scheduler.disableSchedule(pid_idle);
+  effects.lockstep = true;
+  effects.select(0);
+  blackout();
+  effects.select(trace_in.effect_id);
+  trace_frames_done = effects.frames_done;
+  scheduler.alterSchedulePeriod(pid_frame, trace_frame_us / speed);
+  scheduler.enableSchedule(pid_frame, micros());
+  Serial.print("Replaying " TRACE_PATH " at speed ");
+  Serial.println(speed);
+}
+
+
+/*
+* Hands the parser every line due by the start of the next frame, and says when that
+*   is. Returns false once the trace has run out.
+*/
+bool trace_replay_feed(uint32_t* now_us) {
+  uint32_t frame_start = trace_frame * trace_frame_us;
+  while (true) {
+    if (!trace_pending) {
+      if (!trace_in.next(&trace_pending_us, &trace_pending_line, &trace_pending_len)) return false;
+      trace_pending = true;
+    }
+    if ((int32_t) (trace_pending_us - frame_start) > 0) break;
+    process_string_from_counterparty(trace_pending_line, trace_pending_len, trace_pending_us);
+    trace_pending = false;
+  }
+  *now_us = frame_start;
+  trace_frame++;
+  return true;
+}
+
+
+// The last frame has been reported by the time the next one takes any input.
+void trace_note_input(uint32_t stamp) {
+  if (trace_replaying && !trace_frame_had_input) {
+    trace_frame_input     = stamp;
+    trace_frame_had_input = true;
+  }
+}
+
+
+/*
+* Called from the main loop. Reports each frame of the replay once it is drawn.
+*/
+void trace_replay_check() {
+  if (effects.frames_done == trace_frames_done) return;
+  trace_frames_done = effects.frames_done;
+  Effect* e = effects.current();
+  if (NULL == e) return;
+
+  uint32_t render  = e->last_us;
+  uint32_t sum     = matrix.checksum();
+  uint32_t latency = 0;
+  if (trace_frame_had_input) {
+    // In trace time: from when the input came in, to the end of the frame that drew it.
+    latency = ((trace_frame - 1) * trace_frame_us) + render - trace_frame_input;
+    trace_latency_sum += latency;
+    if (latency > trace_latency_max) trace_latency_max = latency;
+    trace_latency_n++;
+    trace_frame_had_input = false;
+  }
+  trace_frames++;
+  trace_render_sum += render;
+  if (render > trace_render_max) trace_render_max = render;
+  trace_sum = (trace_sum ^ sum) * 16777619UL;
+  trace_out.concatf("%u %u %u %08x\n", trace_frame - 1, render, latency, sum);
+}
+
+
+void trace_replay_end() {
+  trace_in.close();
+  trace_replaying  = false;
+  effects.lockstep = false;
+  plasma_scale_set = trace_plasma_scale;
+  set_gol_rule(trace_gol_rule);
+  if (matrix.scanOrder() != trace_scan_order) matrix.setScanOrder(trace_scan_order);
+  plasma_bilinear  = trace_bilinear;
+  pos_filter.setGains(trace_filter_alpha, trace_filter_beta);
+  frame_period_us  = governor.begin(effects.current(), millis());
+  governed_frames  = effects.frames_done;
+  scheduler.alterSchedulePeriod(pid_frame, frame_period_us);
+  scheduler.enableSchedule(pid_frame, micros());
+  note_interaction();
+
+  StringBuilder output;
+  output.concatf("Replay done: %u lines, %u frames drawn\n", trace_in.lines, trace_frames);
+  if (trace_frames) {
+    output.concatf("\tRender:   %uus avg, %uus max\n", trace_render_sum / trace_frames, trace_render_max);
+  }
+  if (trace_latency_n) {
+    output.concatf("\tLatency:  %uus avg, %uus max\n", trace_latency_sum / trace_latency_n, trace_latency_max);
+  }
+  output.concatf("\tChecksum: %08x\n", trace_sum);
+  trace_out.write((const char*) output.string(), output.length());
+  trace_out.close();
+  Serial.print((char*) output.string());
+}
+
+
+/*
+* Acts on a gesture that has come out of the queue.
+*/
+void apply_gesture(const LuxGesture* g, uint32_t now_us) {
+  LuxGesture filtered;
+  trace_note_input(g->stamp);
+  if (GESTURE_POSITION == g->kind) {
+    // Not the sample itself, but where the filter thinks the hand will be once
+    //   this frame is on the panel.
+    filtered = *g;
+    pos_filter.predict(now_us, filtered.pos);
+    g = &filtered;
+
+    // Remember... The e-field box is not kinked 90-degrees.
+    priorx = currentx;
+    priory = currenty;
+
+    currentx = 63 - (g->pos[1] >> 10);   // 63 max.
+    currenty = 95 - (g->pos[0] / 683);   // 96 max.
+    currentc = g->pos[2];
+  }
+
+  // The running effect gets first pick. A swipe it doesn't want moves on to the next one.
+  if (!effects.gesture(g)) {
+    if (GESTURE_SWIPE == g->kind) {
+      blackout();
+      effects.next();
+    }
+  }
+}
+
+
+/*
+* Jobs for the scheduler.
+*/
+void frame_tick() {
+  LuxProfTimer prof(&profiler, prof_frame);
+  uint32_t now_us = micros();
+  uint32_t now_ms = millis();
+  if (trace_replaying) {
+    // Replays run in lockstep, on the trace's own clock rather than ours.
+    if (effects.busy()) return;
+    if (!trace_replay_feed(&now_us)) {
+      trace_replay_end();
+      return;
+    }
+    now_ms = now_us / 1000;
+  }
+  led ^= HIGH;
+  digitalWrite(PIN_LED1, led);
+  LuxGesture g;
+  while (gestures.take(&g)) apply_gesture(&g, now_us);
+  effects.frame(now_ms);
+}
+
+
+void logo_rotate() {
+  logo_effect.skip();
+}
+
+
+// Nobody has been around for a while. Go back to the logos.
+void idle_timeout() {
+  if (EFFECT_LOGOS == effects.currentId()) return;
+  blackout();
+  logo_effect.rewind();
+  effects.select(EFFECT_LOGOS);
+}
+
+
+// Someone is here. Put off the idle timeout. Not while replaying, when there's no one.
+void note_interaction() {
+  if (trace_replaying) return;
+  scheduler.enableSchedule(pid_idle, micros());
+}
+
+
+void create_schedules() {
+  // Frames are never caught up. A frame only starts on a tick once the last one is
+  //   drawn, so a second tick on the same pass could only drop one. A missed period
+  //   is skipped, and the next frame is on the next one.
+  pid_frame       = scheduler.createSchedule("Frame",   frame_period_us,  1, false, frame_tick);
+  pid_logo_rotate = scheduler.createSchedule("Logos",   (uint32_t) LOGO_ROTATE_MS * 1000,  1, false, logo_rotate);
+  pid_idle        = scheduler.createSchedule("Idle",    (uint32_t) IDLE_TIMEOUT_MS * 1000, 1, true,  idle_timeout);
+  scheduler.enableSchedule(pid_frame, micros());
+  note_interaction();
+}
+
+
+/*
+* Called from the main loop. Gives the governor each frame once it is drawn, and runs
+*   the frame job at whatever period comes of it. A replay runs on the trace's clock
+*   instead. While recording one, the period is held, so that the trace's header
+*   stays true of it.
+*/
+void govern_frames() {
+  if (trace_replaying || trace_recording) return;
+  uint32_t p = 0;
+  if (effects.current() != governor.effect()) {
+    p = governor.begin(effects.current(), millis());
+  }
+  else if (effects.frames_done != governed_frames) {
+    p = governor.frameDone(Serial1.available() + ipak_rx.pending(), gestures.count(), millis());
+  }
+  governed_frames = effects.frames_done;
+  if ((0 != p) && (p != frame_period_us)) {
+    frame_period_us = p;
+    scheduler.alterSchedulePeriod(pid_frame, p);
+  }
+}
+
+
+void print_frame_rate() {
+  Effect* e = governor.effect();
+  if (NULL == e) return;
+  StringBuilder output;
+  output.concatf("%s: %u.%ufps, aiming at %u.%ufps (%uus, %u-%uus)%s\n", e->name,
+    governor.fps10() / 10, governor.fps10() % 10, governor.targetFps10() / 10, governor.targetFps10() % 10,
+    e->period_us, e->period_min_us, e->period_max_us, governor.enabled ? "" : ", held");
+  Serial.print((char*) output.string());
+}
+
+
+void create_profiler_scopes() {
+  prof_frame   = profiler.createScope("Frame");
+  prof_slice   = profiler.createScope("Slice");
+  prof_plasma  = profiler.createScope("Plasma");
+  prof_rows    = profiler.createScope("Plasma rows");
+  prof_life    = profiler.createScope("Life");
+  prof_print   = profiler.createScope("Print");
+  prof_logo    = profiler.createScope("Logo");
+  prof_rx      = profiler.createScope("Serial1");
+  prof_parse   = profiler.createScope("Parse");
+  prof_display = profiler.createScope("Display");
+}
+
+
+
+/*****************************************************************************************
+*** Effect bench
+******************************************************************************************
+* Runs every effect that has something to show for a fixed number of frames, back to
+*   back, and reports what its frames cost. Frames are run in lockstep, the way a
+*   replay runs them, so none are skipped for being over budget, and the clock they are
+*   stepped on advances one frame period per frame, whatever the frames really took.
+*
+* This holds the main loop until it is done. Off the board, host/MurumLux.cpp runs it.
+*****************************************************************************************/
+
+#define BENCH_FRAMES   120
+
+void bench_effects(uint16_t frames, StringBuilder* output) {
+  uint8_t  was_running = effects.currentId();
+  uint32_t now_ms      = millis();
+  output->concatf("\n-- Bench: %u frames per effect, each on its own frame period\n", frames);
+  effects.lockstep = true;
+  for (uint8_t i = 0; i < effects.count(); i++) {
+    Effect* e = effects.at(i);
+    if (!e->available()) continue;
+    effects.select(0);
+    blackout();
+    effects.select(effects.idAt(i));
+
+    uint32_t sum = 0;
+    uint32_t min = 0xFFFFFFFF;
+    uint32_t max = 0;
+    for (uint16_t f = 0; f < frames; f++) {
+      effects.frame(now_ms);
+      while (effects.slice(EFFECT_SLICE_US)) {}
+      sum += e->last_us;
+      if (e->last_us < min) min = e->last_us;
+      if (e->last_us > max) max = e->last_us;
+      now_ms += e->period_us / 1000;
+    }
+    output->concatf("\t%-12s %6uus avg %6uus min %6uus max  %08x\n",
+      e->name, sum / frames, min, max, matrix.checksum());
+  }
+  effects.lockstep = false;
+  effects.select(0);
+  blackout();
+  effects.select(was_running);
+}
+
+
+/*
+* The plasma as it was first written, in floats and a pixel at a time, for
+*   bench_plasma() to measure plasma_row() against. It draws the frame for the
+*   angles and hue as they are, and leaves them be.
+*/
+void advance_plasma_float() {
+  const float radius[4]  = { 16.3, 23.0, 40.8, 44.2 };
+  const float centerx[4] = { 16.1, 11.6, 23.4,  4.1 };
+  const float centery[4] = {  8.7,  6.5, 14.0, -2.9 };
+  int sx[4];
+  int sy[4];
+  for (int i = 0; i < 4; i++) {
+    float angle = plasma_angle[i] * (6.2831853f / 65536.0f);
+    sx[i] = (int) (cos(angle) * radius[i] + centerx[i]);
+    sy[i] = (int) (sin(angle) * radius[i] + centery[i]);
+  }
+  for (int y = 0; y < 96; y++) {
+    for (int x = 0; x < 64; x++) {
+      long value = hueShift;
+      for (int i = 0; i < 4; i++) {
+        int dx = sx[i] - x;
+        int dy = sy[i] - y;
+        value += sinetab[(uint8_t) ((dx * dx + dy * dy) >> ((i < 2) ? 2 : 3))];
+      }
+      matrix.drawPixel(x, y, matrix.ColorHSV(value * 3, 255, 255, true));
+    }
+  }
+}
+
+
+/*
+* The plasma on its own, at each scale and fill, in core clock cycles per frame.
+*   Each frame is drawn in one go, with nothing between its slices, and timed in
+*   profiler ticks. A tick is two cycles of the WiFire's core. Off the board, ticks
+*   are 10ns all the same, and the "cycles" are only those ticks times two.
+* The float kernel it replaced is benched first, as a reference. With the centers
+*   where they start (all angles 0), a full-scale frame has to come out the same
+*   from both. Elsewhere, sinetab and cos() round a little differently.
+*/
+#define BENCH_CYCLES_PER_TICK   2
+
+#if defined(ARDUINO)
+  #define BENCH_CYCLES_UNITS   "core cycles"
+#else
+  #define BENCH_CYCLES_UNITS   "cycles (10ns host ticks x 2)"
+#endif
+
+void bench_plasma(uint16_t frames, StringBuilder* output) {
+  uint8_t was_scale_set = plasma_scale_set;
+  bool    was_bilinear  = plasma_bilinear;
+  output->concatf("\n-- Plasma bench: %u frames each, in " BENCH_CYCLES_UNITS " per frame\n", frames);
+
+  uint16_t was_angle[4];
+  long     was_hue = hueShift;
+  memcpy(was_angle, plasma_angle, sizeof(plasma_angle));
+  memset(plasma_angle, 0, sizeof(plasma_angle));
+  uint64_t sum = 0;
+  uint32_t min = 0xFFFFFFFF;
+  uint32_t max = 0;
+  for (uint16_t f = 0; f < frames; f++) {
+    uint32_t t0 = LuxProfiler::ticks();
+    advance_plasma_float();
+    uint32_t t = (LuxProfiler::ticks() - t0) * BENCH_CYCLES_PER_TICK;
+    sum += t;
+    if (t < min) min = t;
+    if (t > max) max = t;
+  }
+  uint32_t reference = matrix.checksum();
+  output->concatf("\t%-17s %9u avg %9u min %9u max  %08x\n",
+    "Float reference", (uint32_t) (sum / frames), min, max, reference);
+  plasma_scale_set = 0;
+  plasma_scale     = 0;
+  plasma_begin();
+  while (!plasma_slice(micros() + 1000000, 0xFFFFFFFF)) {}
+  output->concatf((reference == matrix.checksum()) ?
+    "\tScale 0 matches the float reference.\n" :
+    "\tScale 0 differs from the float reference: %08x\n", matrix.checksum());
+  memcpy(plasma_angle, was_angle, sizeof(plasma_angle));
+  hueShift = was_hue;
+
+  for (uint8_t scale = 0; scale <= PLASMA_MAX_SCALE; scale++) {
+    for (uint8_t fill = 0; fill < (scale ? 2 : 1); fill++) {
+      plasma_scale_set = scale;
+      plasma_scale     = scale;
+      plasma_bilinear  = (0 != fill);
+      sum = 0;
+      min = 0xFFFFFFFF;
+      max = 0;
+      for (uint16_t f = 0; f < frames; f++) {
+        plasma_begin();
+        uint32_t t0 = LuxProfiler::ticks();
+        while (!plasma_slice(micros() + 1000000, 0xFFFFFFFF)) {}
+        uint32_t t = (LuxProfiler::ticks() - t0) * BENCH_CYCLES_PER_TICK;
+        sum += t;
+        if (t < min) min = t;
+        if (t > max) max = t;
+      }
+      output->concatf("\tScale %u %-9s %9u avg %9u min %9u max  %08x\n",
+        scale, scale ? (fill ? "bilinear" : "nearest") : "", (uint32_t) (sum / frames), min, max, matrix.checksum());
+    }
+  }
+  plasma_scale_set = was_scale_set;
+  plasma_bilinear  = was_bilinear;
+  uint8_t was_running = effects.currentId();
+  effects.select(0);
+  blackout();
+  effects.select(was_running);
+}
+
+
+/*
+* Start playing an animation that was built by image_converter/lxa_encode.py. If the
+*   card's was playing, it is stopped.
+*/
+int8_t play_animation(const char* lxa, uint32_t len) {
+  close_anim_stream();
+  if (animation.load((const uint8_t*) lxa, len)) return -1;
+  effects.select(EFFECT_ANIMATION);
+  return 0;
+}
+
+
+/*
+* Takes a line from the e-field box, as a view into ipak_rx (or a trace being replayed),
+*   and the time it came in. The line is terminated, but it doesn't belong to us, so
+*   nothing here should hold on to it.
+*/
+int8_t process_string_from_counterparty(const char* test, uint16_t len, uint32_t now_us) {
+  LuxProfTimer prof(&profiler, prof_parse);
+  if (test == NULL) return -1;
 
-int8_t process_string_from_counterparty(StringBuilder* in) {
-  if (in == NULL) return -1;
-  if (in->length() < 11) return -2;
-  
   StringBuilder output;
-  int8_t return_value = 0;
-  const char* test = (const char*) in->string();
+  Atchvar msg;
+  int8_t return_value = parse_atchvar(test, len, &msg);
 
-  if (strcasestr(test, "ATCHVAR ")) {
+  if (0 == return_value) {
     // This sure looks like it should be here....
-    int variable = atoi((const char*) (test+8));
-    switch (variable) {
-      
-      case 1:   // Position from e-field box.
-        last_interaction = millis();
-        in->cull(10);
-        if (in->split(",") == 3) {
-          // Remember... The e-field box is not kinked 90-degrees.
-          priorx = currentx;
-          priory = currenty;
-          
-          currentx = 63 - (((uint16_t) in->position_as_int(1)) >> 10);   // 63 max.
-          currenty = 95 - (((uint16_t) in->position_as_int(0)) / 683);   // 96 max.
-          currentc = ((uint16_t) in->position_as_int(2));
-          
-          switch (mode) {
-            case 2:
-              *(target_data) = (((int16_t) in->position_as_int(1)) - 32768) * 0.0000003f;
-              hue_shift_s = (int) (currentc - 32768) / 3277;
-              break;
-            case 3:
-              if ((priorx != currentx) || (priory != currenty)) {
-                draw_cursor(priorx, priory, 0);
-                draw_cursor(currentx, currenty, currentc);
-              }
-              break;
-            case 5:
-            case 4:
-              if ((priorx != currentx) || (priory != currenty)) {
-                draw_cursor(priorx, priory, 0);
-                draw_cursor(currentx, currenty, 0xFFE0);
-                priorx = currentx;
-                priory = currenty;
-              }
-              todo[currentx][currenty] = 1;
-              break;
-          }
+    LuxGesture g;
+    g.kind  = msg.var;
+    g.value = msg.args[0];
+    g.stamp = now_us;
+    memset(g.pos, 0, sizeof(g.pos));
+
+    switch (g.kind) {
+      case GESTURE_POSITION:   // Position from e-field box.
+        note_interaction();
+        if (msg.argc == 3) {
+          for (int i = 0; i < 3; i++) g.pos[i] = (uint16_t) msg.args[i];
+          pos_filter.update(g.pos, now_us);   // Every sample, even those that get coalesced.
         }
         else {
           output.concat("This is not enough broccolis.");
+          g.kind = 0;
         }
         break;
-        
-      case 2:   // Airwheel
-        last_interaction = millis();
+
+      case GESTURE_AIRWHEEL:
+        note_interaction();
         break;
-        
-      case 3:   // Swipe direction
-        last_interaction = millis();
-        output.concatf("Swipe 0x%02x\n", atoi(test+10));
-        switch (mode) {
-          case 2:
-            blackout();
-            mode = 3;
-            break;
-          case 3:
-            blackout();
-            mode = 4;
-            break;
-          case 4:
-            blackout();
-            mode = 9;
-            break;
-          case 9:
-          default:
-            blackout();
-            angle1_s =  0.0, angle2_s =  0.0, angle3_s =  0.0, angle4_s =  0.0;
-            mode = 2;
-            break;
-        }
+      case GESTURE_SWIPE:
+        note_interaction();
+        output.concatf("Swipe 0x%02x\n", g.value);
         break;
-      case 4:   // Tap direction
-        last_interaction = millis();
-        output.concatf("Tap 0x%02x\n", atoi(test+10));
-        if (mode == 2) {
-          switch (noise_data_select % 5) {
-            case 0:
-              target_data = &angle1_s;
-              noise_data_select++;
-              break;
-            case 1:
-              target_data = &angle2_s;
-              noise_data_select++;
-              break;
-            case 2:
-              target_data = &angle3_s;
-              noise_data_select++;
-              break;
-            case 3:
-              target_data = &angle4_s;
-              noise_data_select++;
-              break;
-          }
-        }
-        else if (mode == 3) {
-          matrix.drawPixel(currentx, currenty, matrix.ColorHSV(currentc * 3, 255, 255, true));
-        }
-        else if (mode == 9) {
-          action_time_marker = 0;
-        }
+      case GESTURE_TAP:
+        note_interaction();
+        output.concatf("Tap 0x%02x\n", g.value);
         break;
-      case 5:   // Double tap direction
-        last_interaction = millis();
-        output.concatf("Double Tap 0x%02x\n", atoi(test+10));
+      case GESTURE_DOUBLE_TAP:
+        note_interaction();
+        output.concatf("Double Tap 0x%02x\n", g.value);
         break;
-      case 6:   // Touch direction
-        last_interaction = millis();
-        {
-          int touch_val = atoi(test+10);
-          output.concatf("Touch 0x%02x\n", atoi(test+10));
-          switch (mode) {
-            case 4:  // Suspend GoL if we are using it.
-              if (touch_val) mode = 5;
-              break;
-            case 5:  // Resume GoL when touch is relinquished.
-              if (0 == touch_val) mode = 4;
-              break;
-          }
-        }
+      case GESTURE_TOUCH:
+        note_interaction();
+        output.concatf("Touch 0x%02x\n", g.value);
         break;
 
       case 7:   // Special event
-        break;
-        
       case 9:   // Module commands
+      default:
+        g.kind = 0;
         break;
     }
+
+    // Nothing is drawn from here. The next frame takes it from the queue.
+    if (0 != g.kind) gestures.post(&g);
   }
   if (output.length() > 0) Serial.print((char*) output.string());
   return return_value;
@@ -502,13 +1716,15 @@ int8_t process_string_from_counterparty(StringBuilder* in) {
 
 
 void setup() {
+  create_profiler_scopes();
   pinMode(39, INPUT); 
 
   Serial.begin(115200);
   Serial1.begin(115200);
 
-  matrix.init_fb(0);
-  tStart = millis();
+  // Rows far apart in time hide the rolling band that a top-to-bottom sweep makes.
+  // This initializes the render buffer, too.
+  matrix.setScanOrder(SCAN_ORDER_BIT_REVERSED | SCAN_ORDER_STAGGER_PLANES);
 
   pinMode(PIN_LED1, OUTPUT); 
   digitalWrite(PIN_LED1, led);
@@ -519,164 +1735,259 @@ void setup() {
   digitalWrite(34, 0);
   digitalWrite(34, 1);  // Hold MS inactive.
   
+  matrix.makeSprite(&cursor_sprite, cursor_pixels, 5, 5, 0);
+  make_gol_sprites();
+  make_plasma_palette();
   generate_random_gol_state();
-  mode = 4;
+  create_schedules();
+  register_effects();
+  effects.select(EFFECT_GOL);
+
+  // See that the card's animation will open, and then let it go until it's played.
+#if defined(ARDUINO)
+  anim_on_card = ((0 == SDAnimSource::begin()) && (0 == open_anim_stream()));
+#else
+  anim_on_card = (0 == open_anim_stream());
+#endif
+  if (anim_on_card) {
+    Serial.println("Streaming animation found at " SD_ANIMATION_PATH);
+    close_anim_stream();
+  }
 }
 
 
+/*
+* One pass over everything. The core calls this again as soon as it returns, and so
+*   does host/MurumLux.cpp, while it has something for the sketch to do.
+*/
 void loop() {
-  unsigned char x, y;
-
   uint32_t tCur;
+  uint32_t prof_t0;
 //  matrix.begin();
-  
-  uint32_t last_frame_time = 0;
-  
-  const char* logo_list[] = {chipkit_logo, microchip_logo, mpide_logo, manuvr_logo};
-  
-  uint8_t logo_up = 3;
-
-  int frame_rate = 10;
 
-  while (1) {
-    tCur = millis();
+  tCur = millis();
+  
+  if (Serial.available()) {
+    char c = Serial.read();
+    if ((c >= 0x30) && (c < 0x3A)) effects.select(c - 0x30);
     
-    if (Serial.available()) {
-      char c = Serial.read();
-      if ((c >= 0x30) && (c < 0x3A)) mode = (c - 0x30);
-      
-      switch (c) {
-        case 'd':
-          matrix.dumpMatrix();
-          break;
-          
-        case 'f': 
-          frame_rate++; 
-          Serial.print("Frame period: ");
-          Serial.println(frame_rate);
-          break;
-        case 'F': 
-          frame_rate--; 
-          Serial.print("Frame period: ");
-          Serial.println(frame_rate);
-          break;
-
-
-        case '0':
-          matrix.init_fb(0);
-          matrix.init_fb(0);
-          set_logo(logo_list[3]);
-          set_logo(logo_list[3]);
-        case 'q':
-          mode = 0;
-          break;
-        case '1':
-          matrix.init_fb(1);
-          matrix.init_fb(1);
-          set_logo(logo_list[3]);
-          set_logo(logo_list[3]);
-          break;
-        case '2':
-          blackout();
-          break;
-        case '3':
-          matrix.fillScreen(0);
-          matrix.print("Test text\n");
-          break;
-        case '4':
-          generate_random_gol_state();
-          break;
-        case '5':
-          break;
-        case '6':
-          break;
-        case '7':
-          matrix.init_fb(2);
-          matrix.init_fb(2);
-          set_logo(logo_list[3]);
-          set_logo(logo_list[3]);
-          break;
-        case '8':
-          matrix.init_fb(3);
-          matrix.init_fb(3);
-          set_logo(logo_list[3]);
-          set_logo(logo_list[3]);
-          break;
-        case '9':
-          set_logo(logo_list[logo_up % 4]);
-          set_logo(logo_list[logo_up % 4]);
-          logo_up++;
-          action_time_marker = millis();
-          //matrix.fillScreen(0);
-          break;
-      }
-      
-    }
-
-    while (Serial1.available()) {
-      char c = Serial1.read();
-      ipak_rx.concat(c);
-      
-      if (c == '\n') {
-        if (process_string_from_counterparty(&ipak_rx)) {
-          ipak_rx.clear();
+    switch (c) {
+      case 'd':
+        matrix.dumpMatrix();
+        break;
+      case 's':
+        {
+          StringBuilder stat_output;
+          frame_stream.printDebug(&stat_output);
+          animation.printDebug(&stat_output);
+          anim_stream.printDebug(&stat_output);
+          gol.printDebug(&stat_output);
+          gol_hashlife.printDebug(&stat_output);
+          effects.printDebug(&stat_output);
+          scheduler.printDebug(&stat_output);
+          governor.printDebug(&stat_output);
+          ipak_rx.printDebug(&stat_output);
+          gestures.printDebug(&stat_output);
+          pos_filter.printDebug(&stat_output);
+          stat_output.concatf("\tLast jump:     %uus (%u generations owed)\n", gol_jump_micros, gol_skip_gens);
+          stat_output.concatf("\tCells drawn:   %u\n", gol_cells_drawn);
+          stat_output.concatf("\tView:          (%u, %u) zoom %u\n", gol_view_row, gol_view_col, gol_zoom);
+          stat_output.concatf("\tPlasma:        scale %u (%s), %uus/frame\n", plasma_scale, (PLASMA_SCALE_AUTO == plasma_scale_set) ? "auto" : "fixed", plasma_avg4 >> 2);
+          Serial.print((char*) stat_output.string());
         }
-        else {
-          // If it isn't meant for the machine, it is meant for the man looking at the screen. Render it.
-          ipak_rx.clear();
+        break;
+        
+      case 'B':   // Put every effect through its paces. Holds everything else up.
+        {
+          StringBuilder bench_output;
+          bench_effects(BENCH_FRAMES, &bench_output);
+          bench_plasma(BENCH_FRAMES, &bench_output);
+          Serial.print((char*) bench_output.string());
         }
-      }
-    }
+        break;
 
-    if(tCur - tStart > frame_rate) {
-      led ^= HIGH;
-      tStart = tCur;
-      digitalWrite(PIN_LED1, led);
-      if ((mode != 9) && (millis() - last_interaction > 60000)) {
+      case 'P':   // Where the time has gone, since the last time this was asked.
+        profiler.startReport(millis());
+        break;
+
+      case 'f':   // Frame rate, as it is and as the governor is aiming for.
+        print_frame_rate();
+        break;
+      case 'F':   // Hold every frame period where it is, or let the governor have them.
+        governor.enabled = !governor.enabled;
+        print_frame_rate();
+        break;
+      case 'o':   // Cycle the row scan order.
+        {
+          const uint8_t orders[] = {
+            SCAN_ORDER_LINEAR,
+            SCAN_ORDER_INTERLEAVED,
+            SCAN_ORDER_BIT_REVERSED,
+            SCAN_ORDER_BIT_REVERSED | SCAN_ORDER_STAGGER_PLANES
+          };
+          uint8_t i = 0;
+          while ((i < sizeof(orders)) && (orders[i] != matrix.scanOrder())) i++;
+          matrix.setScanOrder(orders[(i + 1) % sizeof(orders)]);
+          Serial.print("Scan order: 0x");
+          Serial.println(matrix.scanOrder(), HEX);
+        }
+        break;
+      case 'h':   // Move the GoL window.
+        gol_pan(0, -8);
+        break;
+      case 'l':
+        gol_pan(0, 8);
+        break;
+      case 'k':
+        gol_pan(-8, 0);
+        break;
+      case 'j':
+        gol_pan(8, 0);
+        break;
+      case '+':
+        gol_set_zoom(gol_zoom - 1);
+        break;
+      case '-':
+        gol_set_zoom(gol_zoom + 1);
+        break;
+      case 'x':   // Skip the GoL ahead.
+        jump_gol_states();
+        break;
+      case 'p':   // Cycle the plasma resolution: auto, full, half, quarter.
+        plasma_scale_set = (PLASMA_SCALE_AUTO == plasma_scale_set) ? 0 : (plasma_scale_set + 1);
+        if (plasma_scale_set > PLASMA_MAX_SCALE) plasma_scale_set = PLASMA_SCALE_AUTO;
+        Serial.print("Plasma scale: ");
+        if (PLASMA_SCALE_AUTO == plasma_scale_set) Serial.println("auto");
+        else Serial.println(plasma_scale_set);
+        break;
+      case 'b':   // Blend the plasma when it is scaled up, or not.
+        plasma_bilinear = !plasma_bilinear;
+        Serial.print("Plasma fill: ");
+        Serial.println(plasma_bilinear ? "bilinear" : "nearest");
+        break;
+      case 'm':   // Cycle the position filter: off, tight, default, smooth.
+        pos_filter_preset = (pos_filter_preset + 1) % (sizeof(pos_filter_presets) / sizeof(pos_filter_presets[0]));
+        pos_filter.setGains(pos_filter_presets[pos_filter_preset][0], pos_filter_presets[pos_filter_preset][1]);
+        Serial.print("Position filter: alpha ");
+        Serial.print(pos_filter.alpha());
+        Serial.print(", beta ");
+        Serial.println(pos_filter.beta());
+        break;
+      case 'T':   // Start or stop recording a gesture trace.
+        if (trace_recording) trace_record_end();
+        else trace_record_begin();
+        break;
+      case 'y':   // Replay the trace as it was recorded...
+        trace_replay_begin(1);
+        break;
+      case 'Y':   // ...or eight times as fast.
+        trace_replay_begin(8);
+        break;
+      case 'a':   // Play the logo wipe out of flash.
+        if (play_animation(logo_wipe, logo_wipe_len)) Serial.println("Failed to load logo_wipe.");
+        break;
+      case 'r':   // Cycle the GoL rule.
+        next_gol_rule();
+        Serial.print("GoL rule: ");
+        Serial.println(LIFE_RULE_LIST[gol_rule_idx]);
+        break;
+
+
+      case '0':
+        matrix.init_fb(0);
+        matrix.init_fb(0);
+        set_logo(logo_list[3]);
+        set_logo(logo_list[3]);
+      case 'q':
+        effects.select(0);
+        break;
+      case '1':
+        matrix.init_fb(1);
+        matrix.init_fb(1);
+        set_logo(logo_list[3]);
+        set_logo(logo_list[3]);
+        break;
+      case '2':
         blackout();
-        action_time_marker = 0;
-        logo_up = 0;
-        mode = 9;
-      }
+        break;
+      case '3':
+        matrix.fillScreen(0);
+        matrix.print("Test text\n");
+        break;
+      case '4':
+        generate_random_gol_state();
+        break;
+      case '5':
+        break;
+      case '6':
+        break;
+      case '7':
+        matrix.init_fb(2);
+        matrix.init_fb(2);
+        set_logo(logo_list[3]);
+        set_logo(logo_list[3]);
+        break;
+      case '8':
+        matrix.init_fb(3);
+        matrix.init_fb(3);
+        set_logo(logo_list[3]);
+        set_logo(logo_list[3]);
+        break;
+      case '9':
+        logo_effect.skip();
+        //matrix.fillScreen(0);
+        break;
+    }
+    
+  }
 
-      switch (mode) {
-        case 1:   // Pixel run mode (for debugging things)
-          matrix.drawPixel(currentx % 64, currentx/64, currentc);
-          currentx++;
-          if (currentx % 16 == 15) {
-            currentc = (uint16_t) random(millis());
-          }
-          break;
-        case 2:   // Coherent noise.
-          advance_plasma();
-          break;
-        case 3:   // Paint mode.
-          if ((priorx != currentx) || (priory != currenty)) {
-            draw_cursor(priorx, priory, 0);
-            draw_cursor(currentx, currenty, currentc);
-          }
-          break;
-        case 4:   // GoL
-          advance_gol_states();
-        case 5:   // GoL
-          print(todo, backup);
-          if ((priorx != currentx) || (priory != currenty)) {
-            draw_cursor(priorx, priory, 0);
-            draw_cursor(currentx, currenty, 0xFFE0);
-          }
-          break;
-
-        case 9:   // Logo cycle
-          if(millis() - action_time_marker > time_until_action) {
-            set_logo(logo_list[logo_up % 4]);
-            set_logo(logo_list[logo_up % 4]);
-            logo_up++;
-            action_time_marker = millis();
-          }
-          break;
+  bool rx_any = (Serial1.available() > 0);   // Only passes that read anything are timed.
+  prof_t0 = LuxProfiler::ticks();
+  while (Serial1.available()) {
+    char c = Serial1.read();
+    if (frame_stream.accept((uint8_t) c, tCur)) continue;   // Binary frame data. Not for the text parser.
+    ipak_rx.push((uint8_t) c);
+
+    if (c == '\n') {
+      // Lines are handled as they complete, so the ring never holds more than one.
+      const char* line;
+      uint16_t    line_len;
+      while (ipak_rx.nextLine(&line, &line_len)) {
+        uint32_t now_us = micros();
+        if (trace_replaying) continue;   // The trace has the floor.
+        if (trace_recording) trace_record(line, line_len, now_us);
+        process_string_from_counterparty(line, line_len, now_us);
       }
     }
+  }
+  if (rx_any) profiler.record(prof_rx, LuxProfiler::ticks() - prof_t0);
+
+  if (frame_stream.frameLanded()) {
+    // A remote host is driving the panel. Get out of its way.
+    note_interaction();
+    effects.select(EFFECT_REMOTE);
+  }
+  if (frame_stream.ackPending()) {
+    StringBuilder ack_output;
+    frame_stream.writeAck(&ack_output);
+    Serial1.print((char*) ack_output.string());
+  }
 
-    matrix.updateDisplay();
+  scheduler.serviceScheduledEvents(micros());
+  prof_t0 = LuxProfiler::ticks();
+  if (effects.slice(EFFECT_SLICE_US)) profiler.record(prof_slice, LuxProfiler::ticks() - prof_t0);
+  if (trace_replaying) trace_replay_check();
+  govern_frames();
+
+  prof_t0 = LuxProfiler::ticks();
+  matrix.updateDisplay();
+  profiler.record(prof_display, LuxProfiler::ticks() - prof_t0);
+
+  if (profiler.reporting()) {
+    // A scope at a time, so the frames keep coming while the report goes out.
+    StringBuilder prof_output;
+    profiler.reportSome(&prof_output);
+    if (prof_output.length() > 0) Serial.print((char*) prof_output.string());
   }
 }
+
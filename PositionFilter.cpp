@@ -0,0 +1,100 @@
+/*
+File:   PositionFilter.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "PositionFilter.h"
+#include <StringBuilder.h>
+
+
+PositionFilter::PositionFilter() {
+  _alpha   = POSITION_FILTER_ALPHA;
+  _beta    = POSITION_FILTER_BETA;
+  _lead_us = POSITION_FILTER_LEAD_US;
+  samples  = 0;
+  resets   = 0;
+  reset();
+}
+
+
+void PositionFilter::reset() {
+  for (uint8_t i = 0; i < POSITION_FILTER_AXES; i++) {
+    _x[i] = 0;
+    _v[i] = 0;
+  }
+  _last_us = 0;
+  _primed  = false;
+}
+
+
+void PositionFilter::setGains(uint16_t alpha, uint16_t beta) {
+  _alpha = (alpha > 256) ? 256 : alpha;
+  _beta  = (beta  > 256) ? 256 : beta;
+}
+
+
+void PositionFilter::setLead(uint32_t lead_us) {
+  _lead_us = lead_us;
+}
+
+
+void PositionFilter::update(const uint16_t* raw, uint32_t now_us) {
+  uint32_t dt = now_us - _last_us;
+  samples++;
+  _last_us = now_us;
+  if (!_primed || (dt > POSITION_FILTER_RESET_US)) {
+    for (uint8_t i = 0; i < POSITION_FILTER_AXES; i++) {
+      _x[i] = ((int32_t) raw[i]) << 8;
+      _v[i] = 0;
+    }
+    _primed = true;
+    resets++;
+    return;
+  }
+  if (0 == dt) dt = 1;
+
+  for (uint8_t i = 0; i < POSITION_FILTER_AXES; i++) {
+    int32_t guess = _x[i] + (int32_t) (((int64_t) _v[i] * dt) / 1000);
+    int32_t miss  = (((int32_t) raw[i]) << 8) - guess;
+    _x[i] = guess + (int32_t) (((int64_t) miss * _alpha) >> 8);
+    _v[i] += (int32_t) (((int64_t) miss * _beta * 1000) / ((int64_t) dt << 8));
+  }
+}
+
+
+void PositionFilter::predict(uint32_t now_us, uint16_t* out) {
+  uint32_t ahead = (now_us + _lead_us) - _last_us;
+  if ((int32_t) ahead < 0) ahead = 0;
+  if (ahead > POSITION_FILTER_MAX_AHEAD_US) ahead = POSITION_FILTER_MAX_AHEAD_US;
+
+  for (uint8_t i = 0; i < POSITION_FILTER_AXES; i++) {
+    int32_t x = _x[i] + (int32_t) (((int64_t) _v[i] * ahead) / 1000);
+    x = (x + 128) >> 8;
+    out[i] = (x < 0) ? 0 : ((x > 0xFFFF) ? 0xFFFF : (uint16_t) x);
+  }
+}
+
+
+void PositionFilter::printDebug(StringBuilder* output) {
+  output->concat("\n-- PositionFilter\n");
+  output->concatf("\tGains:         alpha %u/256, beta %u/256\n", _alpha, _beta);
+  output->concatf("\tLead:          %uus\n", _lead_us);
+  output->concatf("\tSamples:       %u (%u resets)\n", samples, resets);
+}
@@ -0,0 +1,88 @@
+/*
+File:   PositionFilter.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+Smooths the hand position from the e-field box, and guesses where it will be by
+  the time we draw it.
+
+The box reports the raw 16-bit (x, y, z) from the MGC3130 every 15ms or so. Those
+  samples jitter, and by the time one is on the panel it is a report period and a
+  frame old. Each axis here is an alpha-beta filter: it keeps a position and a
+  velocity, and every sample corrects both by some fraction (alpha and beta) of how
+  far off the prediction was. Between samples, the position is run forward along
+  the velocity to the time the frame will be shown.
+
+Larger gains follow the hand more tightly but let through more jitter. The gains are
+  Q8 (256 is 1.0). Everything is integer. Position is kept in Q8 sensor units, and
+  velocity in Q8 sensor units per millisecond.
+
+A gap in the samples longer than POSITION_FILTER_RESET_US means the hand left and
+  came back. The filter starts over from the next sample rather than streaking
+  across the panel from where the hand was last seen. The guess ahead is limited to
+  POSITION_FILTER_MAX_AHEAD_US past the last sample.
+*/
+
+
+#ifndef __MURUMLUX_POSITION_FILTER_H__
+#define __MURUMLUX_POSITION_FILTER_H__
+
+#include <inttypes.h>
+
+#define POSITION_FILTER_AXES             3
+#define POSITION_FILTER_ALPHA          160    // Q8
+#define POSITION_FILTER_BETA            64    // Q8
+#define POSITION_FILTER_LEAD_US       8000    // From the frame starting to it being on the panel.
+#define POSITION_FILTER_RESET_US    200000
+#define POSITION_FILTER_MAX_AHEAD_US 40000
+
+class StringBuilder;
+
+
+class PositionFilter {
+  public:
+    PositionFilter();
+
+    void reset();
+    void setGains(uint16_t alpha, uint16_t beta);   // Q8. (256, 0) passes samples straight through.
+    void setLead(uint32_t lead_us);
+
+    void update(const uint16_t* raw, uint32_t now_us);   // A sample came in.
+    void predict(uint32_t now_us, uint16_t* out);        // Where it will be once drawn.
+
+    inline uint16_t alpha() {   return _alpha;   };
+    inline uint16_t beta() {    return _beta;    };
+
+    void printDebug(StringBuilder*);
+
+    uint32_t samples;
+    uint32_t resets;
+
+
+  private:
+    int32_t  _x[POSITION_FILTER_AXES];   // Q8
+    int32_t  _v[POSITION_FILTER_AXES];   // Q8 per ms
+    uint32_t _last_us;
+    uint32_t _lead_us;
+    uint16_t _alpha;
+    uint16_t _beta;
+    bool     _primed;
+};
+
+#endif
@@ -0,0 +1,35 @@
+/*
+* Stands in for Adafruit_GFX off the board. Only what the panel driver and the sketch
+*   use is here. Text is not drawn.
+*/
+
+#ifndef __MURUMLUX_HOST_ADAFRUIT_GFX_H__
+#define __MURUMLUX_HOST_ADAFRUIT_GFX_H__
+
+#include <Arduino.h>
+
+
+class Adafruit_GFX {
+  public:
+    Adafruit_GFX(int16_t w, int16_t h) : _width(w), _height(h) {};
+    virtual ~Adafruit_GFX() {};
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    virtual void fillScreen(uint16_t color) {
+      for (int16_t x = 0; x < _width; x++) {
+        for (int16_t y = 0; y < _height; y++) drawPixel(x, y, color);
+      }
+    };
+
+    inline void print(const char*) {};
+
+    inline int16_t width() {    return _width;    };
+    inline int16_t height() {   return _height;   };
+
+  protected:
+    int16_t _width;
+    int16_t _height;
+};
+
+#endif
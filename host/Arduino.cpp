@@ -0,0 +1,79 @@
+/*
+File:   Arduino.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+*/
+
+#include "Arduino.h"
+#include <time.h>
+
+HardwareSerial Serial(stdout);
+HardwareSerial Serial1(NULL);
+
+
+static uint64_t host_now_us() {
+  static uint64_t t0 = 0;
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  uint64_t now = ((uint64_t) ts.tv_sec * 1000000ULL) + (ts.tv_nsec / 1000);
+  if (0 == t0) t0 = now;
+  return now - t0;
+}
+
+extern "C" unsigned long micros(void) {   return (uint32_t) host_now_us();            }
+extern "C" unsigned long millis(void) {   return (uint32_t) (host_now_us() / 1000);   }
+
+void delay(uint32_t ms) {
+  struct timespec ts = { (time_t) (ms / 1000), (long) ((ms % 1000) * 1000000) };
+  nanosleep(&ts, NULL);
+}
+
+
+long random(long max) {
+  return (max > 0) ? (rand() % max) : 0;
+}
+
+long random(long min, long max) {
+  return (max > min) ? (min + random(max - min)) : min;
+}
+
+void randomSeed(unsigned long seed) {
+  srand(seed);
+}
+
+
+void HardwareSerial::print(const char* str) {
+  if (_out) fputs(str, _out);
+}
+
+void HardwareSerial::print(char c) {
+  if (_out) fputc(c, _out);
+}
+
+void HardwareSerial::print(long v, int base) {
+  if (!_out) return;
+  if (HEX == base) fprintf(_out, "%lX", v);
+  else fprintf(_out, "%ld", v);
+}
+
+void HardwareSerial::print(unsigned long v, int base) {
+  if (!_out) return;
+  if (HEX == base) fprintf(_out, "%lX", v);
+  else fprintf(_out, "%lu", v);
+}
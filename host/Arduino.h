@@ -0,0 +1,96 @@
+/*
+File:   Arduino.h
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+Stands in for the chipKIT core when the sketch is built off the board. Only what
+  the sketch and its libraries use is here.
+
+Time comes from the host's monotonic clock, counted from the first time it is
+  asked for. Serial writes to stdout, and reads nothing. Serial1 (the e-field box)
+  is silent both ways. Pins go nowhere.
+
+ARDUINO is never defined here. Everything in the tree that is only for the board
+  is behind it.
+*/
+
+
+#ifndef __MURUMLUX_HOST_ARDUINO_H__
+#define __MURUMLUX_HOST_ARDUINO_H__
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef bool     boolean;
+typedef uint8_t  byte;
+
+#define HIGH      1
+#define LOW       0
+#define INPUT     0
+#define OUTPUT    1
+#define DEC      10
+#define HEX      16
+
+#define PIN_LED1 13
+
+extern "C" {
+  unsigned long millis(void);   // As FirmwareDefs.h has them.
+  unsigned long micros(void);
+}
+void     delay(uint32_t ms);
+
+inline void pinMode(uint8_t, uint8_t) {};
+inline void digitalWrite(uint8_t, uint8_t) {};
+inline int  digitalRead(uint8_t) {   return LOW;   };
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+
+class HardwareSerial {
+  public:
+    HardwareSerial(FILE* out) : _out(out) {};
+
+    inline void begin(uint32_t) {};
+    inline int  available() {   return 0;    };
+    inline int  read() {        return -1;   };
+
+    void print(const char*);
+    void print(char);
+    void print(long, int base = DEC);
+    void print(unsigned long, int base = DEC);
+    inline void print(int v, int base = DEC) {            print((long) v, base);            };
+    inline void print(unsigned int v, int base = DEC) {   print((unsigned long) v, base);   };
+
+    template <typename T> inline void println(T v) {   print(v);         print("\n");   };
+    template <typename T> inline void println(T v, int base) {   print(v, base);   print("\n");   };
+    inline void println() {   print("\n");   };
+
+  private:
+    FILE* _out;   // NULL to say nothing.
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+
+#endif
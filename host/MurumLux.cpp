@@ -0,0 +1,213 @@
+/*
+* The sketch, built as an ordinary C++ file off the board. See host/Arduino.h.
+*
+* Off the board, there is no panel to watch and nobody at the console. Set up as usual,
+*   bench every effect, and quit. Frames per effect may be given on the command line.
+*   Or, given "replay" and a speed, replay TRACE_PATH as the 'y' key would, writing
+*   the report to TRACE_REPORT_PATH. Or, given "plasma", bench only the plasma. Or,
+*   given "gol", check GoL's drawing against full redraws. Or, given "anim", check
+*   logo_wipe's frames.
+*/
+
+#include "../MurumLux.pde"
+
+
+/*
+* GoL only draws the pixels whose look changed (see gol_print_rows()). So after
+*   every frame, the panel has to be the same as a full redraw of the window would
+*   leave it. The cursor is moved, the window zoomed and panned, and the rule
+*   changed to a Generations one along the way, as they all leave pixels to redraw.
+*   Returns non-zero at the first frame that differs.
+*/
+int check_gol_redraw(uint16_t frames) {
+  uint32_t now_ms = millis();
+  effects.lockstep = true;
+  effects.select(0);
+  blackout();
+  effects.select(EFFECT_GOL);
+  uint32_t cells = 0;
+
+  for (uint16_t f = 0; f < frames; f++) {
+    if (5 == (f % 16)) {
+      LuxGesture g;
+      g.kind   = GESTURE_POSITION;
+      priorx   = currentx;
+      priory   = currenty;
+      currentx = (f * 7) % GOL_VIEW_ROWS;
+      currenty = (f * 13) % GOL_VIEW_COLS;
+      effects.gesture(&g);
+    }
+    if (20 == (f % 40)) gol_set_zoom((gol_zoom + 1) % (GOL_MAX_ZOOM + 1));
+    if (30 == (f % 60)) gol_pan(5, -3);
+    if ((frames / 2) == f) set_gol_rule(5);   // B2/S/C3. Dying cells fade.
+
+    uint32_t cells0 = gol_cells_drawn;
+    effects.frame(now_ms);
+    while (effects.slice(EFFECT_SLICE_US)) {}
+    cells += gol_cells_drawn - cells0;
+    now_ms += 10;
+
+    uint32_t drawn = matrix.checksum();
+    gol_invalidate(0, 0, GOL_VIEW_ROWS, GOL_VIEW_COLS);
+    print(&gol);
+    matrix.drawSprite(&cursor_sprite, currentx-2, currenty-2);
+    if (drawn != matrix.checksum()) {
+      printf("GoL frame %u (zoom %u) was drawn as %08x, but a full redraw is %08x.\n", f, gol_zoom, drawn, matrix.checksum());
+      return 1;
+    }
+  }
+  printf("GoL: all %u frames came out as full redraws would, drawing %u cells a frame.\n",
+    frames, cells / frames);
+  effects.lockstep = false;
+  return 0;
+}
+
+
+/*
+* logo_wipe holds each of three logos, then wipes the next one over it from the left,
+*   eight columns a frame. So what every frame should look like can be drawn straight
+*   from the logos. It is played as the 'a' key would, with no time at all for each
+*   slice, so that every frame is left part-drawn after each of its rects. And twice
+*   over, so the loop is covered too.
+* Then the same container is written to SD_ANIMATION_PATH and played again from the
+*   file, as the card's animation would be, through FileAnimSource and LuxAnimStream.
+*   Every frame has to come out as it did from flash.
+* Returns non-zero at the first frame that differs, or if either source is still
+*   open once the other has been started or something else has taken the panel.
+*/
+#define ANIM_LOGO_FRAMES   15
+#define ANIM_FRAMES        (ANIM_LOGO_FRAMES * 3 * 2)
+#define ANIM_PERIOD_MS     80
+#define ANIM_SLICE_US      0
+
+// Draws the given frame of logo_wipe, as it should be, and returns the checksum.
+uint32_t logo_wipe_frame(uint16_t f) {
+  const char* seq[] = {digilent_logo, manuvr_logo, microchip_logo};
+  uint8_t  k     = f % ANIM_LOGO_FRAMES;
+  uint16_t* from = (uint16_t*) seq[(f / ANIM_LOGO_FRAMES) % 3];
+  uint16_t* to   = (uint16_t*) seq[((f / ANIM_LOGO_FRAMES) + 1) % 3];
+  uint8_t  wiped = (k < 4) ? 0 : ((k - 3) * 8);
+  for (int a = 0; a < 96*64; a++) {
+    matrix.drawPixel((a / 96), (95 - (a % 96)), ((a % 96) < wiped) ? to[a] : from[a]);
+  }
+  return matrix.checksum();
+}
+
+// Ticks the animation effect for a frame. Returns the number of slices it took.
+uint32_t anim_frame(uint32_t* now_ms) {
+  uint32_t slices = 0;
+  effects.frame(*now_ms);
+  while (effects.slice(ANIM_SLICE_US)) slices++;
+  *now_ms += ANIM_PERIOD_MS;
+  return slices;
+}
+
+int check_animation() {
+  uint32_t flash[ANIM_FRAMES];
+  uint32_t now_ms = millis();
+  effects.lockstep = true;
+  effects.select(0);
+  blackout();
+  if (play_animation(logo_wipe, logo_wipe_len) || !animation.loaded()) {
+    printf("Animation: logo_wipe didn't load.\n");
+    return 1;
+  }
+
+  uint32_t slices = 0;
+  for (uint16_t f = 0; f < ANIM_FRAMES; f++) {
+    uint32_t drawn0 = animation.frames_drawn;
+    slices += anim_frame(&now_ms);
+    if ((drawn0 + 1) != animation.frames_drawn) {
+      printf("Animation: tick %u drew %u frames.\n", f, animation.frames_drawn - drawn0);
+      return 1;
+    }
+    flash[f] = matrix.checksum();
+    if (flash[f] != logo_wipe_frame(f % (ANIM_FRAMES / 2))) {
+      printf("Animation: frame %u was drawn as %08x, but should be %08x.\n", f, flash[f], matrix.checksum());
+      return 1;
+    }
+  }
+  printf("Animation: all %u frames came out as they should, %u slices a frame, %u loops.\n",
+    ANIM_FRAMES, slices / ANIM_FRAMES, animation.loops);
+
+  effects.select(0);
+  if (animation.loaded()) {
+    printf("Animation: still loaded after another effect took the panel.\n");
+    return 1;
+  }
+
+  // The same again, from a file.
+  FILE* fp = fopen(SD_ANIMATION_PATH, "wb");
+  if ((NULL == fp) || (logo_wipe_len != fwrite(logo_wipe, 1, logo_wipe_len, fp))) {
+    printf("Animation: couldn't write " SD_ANIMATION_PATH ".\n");
+    return 1;
+  }
+  fclose(fp);
+  anim_on_card = true;
+  blackout();
+  effects.select(EFFECT_ANIMATION);
+  if (!anim_stream.loaded() || animation.loaded()) {
+    printf("Animation: " SD_ANIMATION_PATH " wasn't opened on its own.\n");
+    return 1;
+  }
+
+  slices = 0;
+  for (uint16_t f = 0; f < ANIM_FRAMES; f++) {
+    uint32_t drawn0 = anim_stream.frames_drawn;
+    slices += anim_frame(&now_ms);
+    if ((drawn0 + 1) != anim_stream.frames_drawn) {
+      printf("Stream: tick %u drew %u frames.\n", f, anim_stream.frames_drawn - drawn0);
+      return 1;
+    }
+    if (flash[f] != matrix.checksum()) {
+      printf("Stream: frame %u was drawn as %08x, but from flash it was %08x.\n", f, matrix.checksum(), flash[f]);
+      return 1;
+    }
+  }
+  printf("Stream: all %u frames came out as they did from flash, %u slices a frame, %u loops.\n",
+    ANIM_FRAMES, slices / ANIM_FRAMES, anim_stream.loops);
+  printf("\t%u reads, %u underruns, %u errors.\n", anim_stream.reads, anim_stream.underruns, anim_stream.errors);
+  if (anim_stream.errors) return 1;
+
+  // Starting the flash animation stops the stream, and the panel going elsewhere
+  //   releases whichever is playing.
+  play_animation(logo_wipe, logo_wipe_len);
+  if (anim_stream.loaded()) {
+    printf("Stream: still open after logo_wipe was started.\n");
+    return 1;
+  }
+  effects.select(0);
+  if (animation.loaded() || anim_stream.loaded()) {
+    printf("Animation: still loaded after another effect took the panel.\n");
+    return 1;
+  }
+  effects.lockstep = false;
+  return 0;
+}
+
+
+int main(int argc, char** argv) {
+  setup();
+  if ((argc > 1) && (0 == strcmp(argv[1], "replay"))) {
+    int speed = (argc > 2) ? atoi(argv[2]) : 1;
+    trace_replay_begin((speed < 1) ? 1 : ((speed > 255) ? 255 : speed));
+    if (!trace_replaying) return 1;
+    while (trace_replaying) loop();
+    return 0;
+  }
+  if ((argc > 1) && (0 == strcmp(argv[1], "gol"))) {
+    return check_gol_redraw((argc > 2) ? atoi(argv[2]) : BENCH_FRAMES);
+  }
+  if ((argc > 1) && (0 == strcmp(argv[1], "anim"))) {
+    return check_animation();
+  }
+  StringBuilder output;
+  if ((argc > 1) && (0 == strcmp(argv[1], "plasma"))) {
+    bench_plasma((argc > 2) ? atoi(argv[2]) : BENCH_FRAMES, &output);
+    Serial.print((char*) output.string());
+    return 0;
+  }
+  bench_effects((argc > 1) ? atoi(argv[1]) : BENCH_FRAMES, &output);
+  Serial.print((char*) output.string());
+  return 0;
+}
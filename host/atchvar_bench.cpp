@@ -0,0 +1,123 @@
+/*
+File:   atchvar_bench.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+ATCHVAR parsing, old and new, off the board.
+
+    atchvar_bench [messages]
+
+Parses a position and a tap that many times each, the way the sketch used to (a
+  StringBuilder per line, found with strcasestr(), and cut up with cull() and
+  split()), and then with parse_atchvar(). Reports messages per second for both.
+
+The accept and reject cases for parse_atchvar() are run first. Exits non-zero if
+  any of them fail.
+*/
+
+#include "Arduino.h"
+#include "Atchvar.h"
+#include <StringBuilder.h>
+
+#define BENCH_MESSAGES  200000
+
+static uint8_t failures = 0;
+static volatile int32_t sink = 0;   // So that nothing gets optimized away.
+
+
+static void expect(const char* line, int8_t ret, int32_t var = 0, uint8_t argc = 0, int32_t a0 = 0, int32_t a1 = 0, int32_t a2 = 0) {
+  Atchvar msg;
+  int8_t r = parse_atchvar(line, strlen(line), &msg);
+  if ((r != ret) || ((0 == ret) && ((msg.var != var) || (msg.argc != argc) || (msg.args[0] != a0) || (msg.args[1] != a1) || (msg.args[2] != a2)))) {
+    printf("FAIL: \"%s\" gave %d (var %d, %u args: %d, %d, %d)\n", line, r, msg.var, msg.argc, msg.args[0], msg.args[1], msg.args[2]);
+    failures++;
+  }
+}
+
+
+/*
+* As process_string_from_counterparty() was, less everything but the parsing.
+*/
+static void parse_old(const char* line) {
+  StringBuilder in((char*) line);
+  const char* test = (const char*) in.string();
+  if (strcasestr(test, "ATCHVAR ")) {
+    int variable = atoi(test + 8);
+    if (1 == variable) {
+      in.cull(10);
+      if (in.split(",") == 3) {
+        for (int i = 0; i < 3; i++) sink += in.position_as_int(i);
+      }
+    }
+    else {
+      sink += atoi(test + 10);
+    }
+  }
+}
+
+
+static void parse_new(const char* line, uint16_t len) {
+  Atchvar msg;
+  if (0 == parse_atchvar(line, len, &msg)) sink += msg.var + msg.args[0] + msg.args[1] + msg.args[2];
+}
+
+
+int main(int argc, char** argv) {
+  uint32_t n = (argc > 1) ? strtoul(argv[1], NULL, 10) : BENCH_MESSAGES;
+  if (0 == n) n = 1;
+
+  expect("ATCHVAR 1 0x7a12,0x9d13,0x007b", 0, 1, 3, 0x7a12, 0x9d13, 0x7b);
+  expect("ATCHVAR 2 -3",            0, 2, 1, -3);
+  expect("atchvar 4 12\r",          0, 4, 1, 12);
+  expect("junkATCHVATCHVAR 3 5",    0, 3, 1, 5);
+  expect("ATCHVAR 8 12,0,2",        0, 8, 3, 12, 0, 2);
+  expect("ATCHVAR 8 1 2  3",        0, 8, 3, 1, 2, 3);
+  expect("ATCHVAR 7",               0, 7, 0);
+  expect("ATCHVAR 1 0X1F , 010, 0", 0, 1, 3, 31, 10, 0);
+  expect("hello",              -1);
+  expect("ATCHVAR",            -1);
+  expect("ATCHVAR ",           -2);
+  expect("ATCHVAR 1 1,2,3,4",  -2);
+  expect("ATCHVAR 1 1,,2",     -2);
+  expect("ATCHVAR 1 1,",       -2);
+  expect("ATCHVAR 1,2",        -2);
+  expect("ATCHVAR 1 0x",       -2);
+  expect("ATCHVAR 1 12q",      -2);
+  expect("ATCHVAR 1 -",        -2);
+  printf("Cases: %u failed\n", failures);
+
+  const char* lines[] = { "ATCHVAR 1 0x7a12,0x9d13,0x007b", "ATCHVAR 4 12" };
+  for (uint8_t w = 0; w < 2; w++) {
+    const char* line = lines[w];
+    uint16_t    len  = strlen(line);
+
+    uint32_t t0 = micros();
+    for (uint32_t i = 0; i < n; i++) parse_old(line);
+    uint32_t old_us = (micros() - t0) | 1;
+
+    t0 = micros();
+    for (uint32_t i = 0; i < n; i++) parse_new(line, len);
+    uint32_t new_us = (micros() - t0) | 1;
+
+    printf("%s\n", line);
+    printf("\tStringBuilder:  %10u msgs/s\n", (uint32_t) (((uint64_t) n * 1000000) / old_us));
+    printf("\tparse_atchvar:  %10u msgs/s\n", (uint32_t) (((uint64_t) n * 1000000) / new_us));
+  }
+  return (failures ? 1 : 0);
+}
@@ -0,0 +1,14 @@
+/*
+* Stands in for avr/pgmspace.h off the board. Flash is just memory here.
+*/
+
+#ifndef __MURUMLUX_HOST_PGMSPACE_H__
+#define __MURUMLUX_HOST_PGMSPACE_H__
+
+#include <inttypes.h>
+
+#define PROGMEM
+#define pgm_read_byte(addr)   (*((const uint8_t*) (addr)))
+#define pgm_read_word(addr)   (*((const uint16_t*) (addr)))
+
+#endif
@@ -0,0 +1,188 @@
+/*
+File:   effect_registry_test.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+EffectRegistry, off the board.
+
+    effect_registry_test
+
+A few effects that do nothing but count what is asked of them. Checks that:
+  - Bad registrations (duplicate ids, no effect, bad period bounds, too many) are
+    refused.
+  - select() ends the effect running and begins the new one, and selecting an id
+    with nothing registered leaves nothing running.
+  - next() cycles in the order effects were registered, passing over effects
+    out of the cycle and effects with nothing to show.
+  - Frames are drawn over as many slices as the effect takes, a frame tick that
+    comes while one is still drawing is dropped, and gestures go to the running
+    effect.
+  - An effect three times over its budget sits out frames to come back under,
+    unless the registry is in lockstep.
+
+Exits non-zero if any of them don't hold.
+*/
+
+#include "Arduino.h"
+#include "Effect.h"
+#include <StringBuilder.h>
+
+#define TEST_FRAMES   40
+
+static uint8_t failures = 0;
+
+
+class CountEffect : public Effect {
+  public:
+    CountEffect(const char* n, uint8_t s = 1, uint32_t c = 0) : Effect(n) {
+      slices_per_frame = s;
+      cost_us  = c;
+      showing  = true;
+      begins   = 0;
+      ends     = 0;
+      steps    = 0;
+      gestures = 0;
+      _left    = 0;
+    };
+
+    void begin() {   begins++;   };
+    void end() {     ends++;     };
+    void step(uint32_t /* now_ms */) {   steps++;   _left = slices_per_frame;   };
+    bool render(uint32_t /* slice_end_us */) {
+      // Spins for its share of the cost, as a real effect would draw.
+      uint32_t until = micros() + (cost_us / slices_per_frame);
+      while ((int32_t) (micros() - until) < 0) {}
+      return (0 == --_left);
+    };
+    bool onGesture(const LuxGesture*) {   gestures++;   return true;   };
+    bool available() {   return showing;   };
+
+    uint8_t  slices_per_frame;
+    uint32_t cost_us;
+    bool     showing;
+    uint32_t begins;
+    uint32_t ends;
+    uint32_t steps;
+    uint32_t gestures;
+
+  private:
+    uint8_t  _left;
+};
+
+
+static void check(bool ok, const char* what) {
+  printf("\t%-58s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok) failures++;
+}
+
+
+// Ticks and slices until the running effect has drawn a frame, or a tick was dropped.
+static void run_frame(EffectRegistry* reg, uint32_t* now_ms) {
+  reg->frame(*now_ms += 10);
+  while (reg->busy()) reg->slice(1000);
+}
+
+
+int main() {
+  EffectRegistry reg;
+  CountEffect a("A");
+  CountEffect b("B", 3);
+  CountEffect c("C");
+  CountEffect d("D");
+  CountEffect hog("Hog", 1, 3000);
+
+  check(0 == reg.add(1, &a, 0, true), "Registers an effect");
+  check(0 == reg.add(2, &b, 0, true), "...and another");
+  check(-2 == reg.add(1, &c, 0, true), "Refuses an id already taken");
+  check(-1 == reg.add(9, NULL, 0, true), "Refuses no effect");
+  check(-4 == reg.add(9, &c, 0, true, 0, 100), "Refuses a shortest period of 0");
+  check(-4 == reg.add(9, &c, 0, true, 200, 100), "Refuses bounds the wrong way around");
+  check(0 == reg.add(3, &c, 0, false), "Registers one out of the cycle");
+  check(0 == reg.add(4, &d, 0, true), "...and one after it, in the cycle");
+  check(0 == reg.add(5, &hog, 1000, false), "...and one that runs over its budget");
+  for (uint8_t i = reg.count(); i < EFFECT_MAX_COUNT; i++) reg.add(100 + i, &c, 0, false);
+  check(-3 == reg.add(99, &c, 0, true), "Refuses more than EFFECT_MAX_COUNT");
+  check(NULL == reg.current(), "Nothing runs until selected");
+
+  reg.select(1);
+  check((&a == reg.current()) && (1 == a.begins), "select() begins the effect");
+  reg.select(1);
+  check(1 == a.begins, "...only once, if it's already running");
+  reg.select(2);
+  check((1 == a.ends) && (&b == reg.current()) && (1 == b.begins), "...and ends the one before");
+  reg.select(7);
+  check((NULL == reg.current()) && (1 == b.ends), "An empty slot leaves nothing running");
+  reg.frame(0);
+  check(!reg.slice(1000), "...and nothing to draw");
+
+  reg.select(1);
+  reg.next();
+  check(&b == reg.current(), "next() goes in the order registered");
+  reg.next();
+  check(&d == reg.current(), "...past effects out of the cycle");
+  b.showing = false;
+  reg.next();
+  check(&a == reg.current(), "...and around, from the last");
+  reg.next();
+  check(&d == reg.current(), "...past effects with nothing to show");
+  reg.select(3);
+  reg.next();
+  check(&d == reg.current(), "From out of the cycle, to the next one in it");
+  b.showing = true;
+
+  // A frame in three slices. Ticks that come while it's drawing are dropped.
+  uint32_t now_ms = 0;
+  reg.select(2);
+  reg.frame(now_ms += 10);
+  reg.slice(1000);
+  reg.frame(now_ms += 10);
+  reg.slice(1000);
+  check(reg.busy() && (1 == b.steps), "A frame is drawn over the slices it takes");
+  reg.slice(1000);
+  check(!reg.busy() && (1 == b.frames) && (3 == b.slices), "...and counted once it's done");
+  check(1 == b.dropped, "A tick while it's drawing is dropped");
+
+  LuxGesture g;
+  g.kind = GESTURE_TAP;
+  check(reg.gesture(&g) && (1 == b.gestures) && (0 == a.gestures), "Gestures go to the running effect");
+
+  // Three times over budget. In lockstep, it draws every frame.
+  reg.select(5);
+  reg.lockstep = true;
+  for (uint8_t i = 0; i < TEST_FRAMES; i++) run_frame(&reg, &now_ms);
+  check((TEST_FRAMES == hog.frames) && (0 == hog.skipped), "In lockstep, an effect over budget draws every frame");
+  check(TEST_FRAMES == hog.overruns, "...and every one is an overrun");
+
+  reg.lockstep = false;
+  uint32_t frames = hog.frames;
+  for (uint8_t i = 0; i < TEST_FRAMES; i++) run_frame(&reg, &now_ms);
+  frames = hog.frames - frames;
+  printf("\t(%u of %u frames drawn, %u skipped)\n", frames, TEST_FRAMES, hog.skipped);
+  check((frames + hog.skipped) == TEST_FRAMES, "Every frame is either drawn or skipped");
+  check((frames >= (TEST_FRAMES / 5)) && (frames <= (TEST_FRAMES / 3)), "Otherwise, it sits out frames to come back under budget");
+
+  StringBuilder output;
+  reg.printDebug(&output);
+  printf("%s\n", (char*) output.string());
+  if (failures) {
+    printf("FAIL: %u checks.\n", failures);
+    return 1;
+  }
+  return 0;
+}
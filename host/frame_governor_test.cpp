@@ -0,0 +1,162 @@
+/*
+File:   frame_governor_test.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+FrameGovernor, off the board.
+
+    frame_governor_test
+
+Frame costs are set in the effect by hand, as the registry would have measured
+  them, so nothing here depends on how fast the host is. Checks that:
+  - An effect that is cheap enough runs at its shortest period.
+  - A frame that costs more than the period allows (less the headroom) raises the
+    period at once, to what it needs.
+  - Once frames are cheap again, the period eases back down a little per frame,
+    never below what they need, and gets there in the end.
+  - Input piling up raises the period, even when the frames are cheap.
+  - The period stays in the effect's bounds, and each effect keeps its own.
+  - When the governor is off, the period is held where it is.
+  - The frame rate is measured over a second.
+
+Exits non-zero if any of them don't hold.
+*/
+
+#include "Arduino.h"
+#include "Effect.h"
+#include "FrameGovernor.h"
+#include <StringBuilder.h>
+
+static uint8_t failures = 0;
+
+
+class CostEffect : public Effect {
+  public:
+    CostEffect(const char* n) : Effect(n) {};
+    bool render(uint32_t /* slice_end_us */) {   return true;   };
+
+    // As the registry would leave it, after a frame that cost this much.
+    void cost(uint32_t us) {
+      last_us  = us;
+      avg4_us += us - (avg4_us >> 2);
+    };
+};
+
+
+static void check(bool ok, const char* what) {
+  printf("\t%-58s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok) failures++;
+}
+
+
+int main() {
+  FrameGovernor gov;
+  CostEffect    a("A");
+  CostEffect    b("B");
+  a.period_min_us = 10000;
+  a.period_max_us = 50000;
+  a.period_us     = 10000;
+  b.period_min_us = 20000;
+  b.period_max_us = 40000;
+  b.period_us     = 20000;
+  uint32_t now_ms = 0;
+  uint32_t p;
+
+  check(10000 == gov.begin(&a, now_ms), "Starts where the effect was");
+
+  // 3ms frames need 4ms periods, at 25% headroom. The bound is 10ms.
+  for (uint8_t i = 0; i < 8; i++) {
+    a.cost(3000);
+    p = gov.frameDone(0, 0, now_ms += 10);
+  }
+  check((10000 == p) && (0 == gov.raises), "Cheap frames run at the shortest period");
+
+  // One 15ms frame needs 20ms.
+  a.cost(15000);
+  p = gov.frameDone(0, 0, now_ms += 10);
+  check(20000 == p, "An expensive frame raises the period at once...");
+  check(1 == gov.raises, "...and is counted");
+
+  // Back to 6ms frames. They need 8ms, so the bound is what they come down to.
+  bool     eased  = true;
+  bool     slowly = true;
+  uint32_t prior  = p;
+  uint16_t frames = 0;
+  while ((p > 10000) && (frames < 1000)) {
+    a.cost(6000);
+    p = gov.frameDone(0, 0, now_ms += 10);
+    uint32_t need = ((a.avg4_us >> 2) > a.last_us) ? (a.avg4_us >> 2) : a.last_us;
+    need = (need * 100) / 75;
+    eased  &= (p <= prior) && (p >= need || p == 10000);
+    slowly &= ((prior - p) <= (prior >> 3));
+    prior = p;
+    frames++;
+  }
+  check(eased, "Cheaper frames bring it down, never under what they need");
+  check(slowly && (frames > 8), "...a little at a time");
+  check(10000 == p, "...until it's back at the shortest");
+  check(1 == gov.raises, "...without raising it again");
+
+  // Cheap frames, but input waiting after each of them.
+  a.cost(3000);
+  p = gov.frameDone(FRAME_GOVERNOR_RX_BACKLOG + 1, 0, now_ms += 10);
+  check(11250 == p, "Bytes piling up on the link raise the period an eighth");
+  a.cost(3000);
+  p = gov.frameDone(0, FRAME_GOVERNOR_GESTURE_BACKLOG + 1, now_ms += 10);
+  check(12656 == p, "...and so do gestures piling up");
+  check(2 == gov.backlogs, "...and both are counted");
+  a.cost(3000);
+  p = gov.frameDone(FRAME_GOVERNOR_RX_BACKLOG, FRAME_GOVERNOR_GESTURE_BACKLOG, now_ms += 10);
+  check(p < 12656, "Input at the backlog limits doesn't");
+
+  // Far too expensive for the bounds.
+  for (uint8_t i = 0; i < 4; i++) a.cost(100000);
+  p = gov.frameDone(0, 0, now_ms += 10);
+  check(50000 == p, "The period is held to the effect's longest");
+
+  // Hold. Nothing moves with the governor off, whatever the frames cost.
+  gov.enabled = false;
+  for (uint8_t i = 0; i < 8; i++) a.cost(1000);
+  p = gov.frameDone(FRAME_GOVERNOR_RX_BACKLOG * 2, 0, now_ms += 10);
+  check((50000 == p) && (50000 == a.period_us), "With the governor off, the period is held");
+  gov.enabled = true;
+
+  // Another effect takes the panel, and then gives it back.
+  check(20000 == gov.begin(&b, now_ms), "The next effect starts where it was");
+  b.cost(1000);
+  p = gov.frameDone(0, 0, now_ms += 10);
+  check(20000 == p, "...and is held to its own shortest");
+  check(50000 == gov.begin(&a, now_ms), "The first picks up where it left off");
+
+  // 25 frames, evenly over a bit more than a second.
+  for (uint8_t i = 0; i < 25; i++) {
+    a.cost(1000);
+    gov.frameDone(0, 0, now_ms += 40);
+  }
+  check(250 == gov.fps10(), "The frame rate is measured over a second");
+
+  StringBuilder output;
+  gov.printDebug(&output);
+  printf("%s\n", (char*) output.string());
+  if (failures) {
+    printf("FAIL: %u checks.\n", failures);
+    return 1;
+  }
+  return 0;
+}
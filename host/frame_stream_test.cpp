@@ -0,0 +1,367 @@
+/*
+File:   frame_stream_test.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+FrameStream, off the board.
+
+    frame_stream_test [stream]
+
+Packets are built here, with a Fletcher-16 and a run-length encoder of our own,
+  and fed in between lines of text. After each frame, the panel is checked against
+  a full redraw of what it ought to show. Checks that:
+  - Text is left to the text parser, and everything after a sync byte is ours.
+  - The Fletcher-16 matches known values, and packets that carry it are taken.
+  - Literal runs, repeats, and runs of the longest length all land where they should.
+  - A keyframe has to cover the whole image to be a base for deltas.
+  - A packet with a bad checksum or a malformed rect list is refused, and a packet
+    with a bad checksum leaves the panel as it was.
+  - Lost frames and deltas with no base are dropped, and a keyframe asked for.
+  - What's left of a packet that stalls is skipped, not handed to the text parser,
+    and so is everything after a bad header, up to the next sync byte.
+Given a stream written by image_converter/framestream_send.py -o, every frame in it
+  is checked against the logos as well. host/traces/logo_wipe.fs is the one ctest
+  uses. It was made from the frames logo_wipe was built from (see static_animations.c):
+    framestream_send.py -o logo_wipe.fs --period 80 --loops 2 f*.png
+
+Exits non-zero if any of them don't hold.
+*/
+
+#include "Arduino.h"
+#include "FrameStream.h"
+#include <RGBmatrixPanel.h>
+#include <StringBuilder.h>
+#include "../static_images.c"
+
+#define TEST_W   FRAME_IMAGE_WIDTH
+#define TEST_H   FRAME_IMAGE_HEIGHT
+
+static uint8_t failures = 0;
+
+static RGBmatrixPanel matrix;
+static FrameStream    fs(&matrix);
+static FrameStream    file_fs(&matrix);   // For the stream given on the command line, from its start.
+
+static uint16_t frame[TEST_H][TEST_W];   // What's being sent.
+static uint16_t shown[TEST_H][TEST_W];   // What the panel ought to show.
+
+static uint8_t  payload[FRAME_STREAM_MAX_PAYLOAD];
+static uint16_t payload_len = 0;
+static uint8_t  pkt[FRAME_STREAM_MAX_PAYLOAD + 7];
+static uint16_t pkt_len     = 0;
+static uint32_t now_ms      = 1000;
+
+
+static void check(bool ok, const char* what) {
+  printf("\t%-58s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok) failures++;
+}
+
+
+static uint16_t fletcher16(const uint8_t* buf, uint32_t len) {
+  uint16_t a = 0;
+  uint16_t b = 0;
+  for (uint32_t i = 0; i < len; i++) {
+    a = (a + buf[i]) % 255;
+    b = (b + a) % 255;
+  }
+  return (b << 8) | a;
+}
+
+
+// Wraps what is in payload[] for the wire.
+static void make_packet(uint8_t type, uint8_t seq) {
+  pkt[0] = FRAME_STREAM_SYNC;
+  pkt[1] = type;
+  pkt[2] = seq;
+  pkt[3] = payload_len & 0xFF;
+  pkt[4] = payload_len >> 8;
+  memcpy(&pkt[5], payload, payload_len);
+  uint16_t csum = fletcher16(&pkt[1], payload_len + 4);
+  pkt[payload_len + 5] = csum & 0xFF;
+  pkt[payload_len + 6] = csum >> 8;
+  pkt_len = payload_len + 7;
+}
+
+
+// Returns the number of bytes that were left for the text parser.
+static uint32_t send(const uint8_t* buf, uint32_t len) {
+  uint32_t text = 0;
+  for (uint32_t i = 0; i < len; i++) {
+    if (!fs.accept(buf[i], now_ms)) text++;
+  }
+  return text;
+}
+
+static uint32_t send_text(const char* str) {   return send((const uint8_t*) str, strlen(str));   }
+static uint32_t send_packet() {                return send(pkt, pkt_len);                      }
+
+
+// Appends a rect of frame[][], run-length encoded as lxa_encode.py would do it.
+static void add_rect(uint8_t col, uint8_t row, uint8_t w, uint8_t h) {
+  uint16_t px[TEST_W * TEST_H];
+  uint16_t n = 0;
+  for (uint8_t r = row; r < row + h; r++) {
+    for (uint8_t c = col; c < col + w; c++) px[n++] = frame[r][c];
+  }
+  payload[payload_len++] = col;
+  payload[payload_len++] = row;
+  payload[payload_len++] = w;
+  payload[payload_len++] = h;
+  uint16_t i = 0;
+  while (i < n) {
+    uint16_t j = i;
+    while ((j < n) && (px[j] == px[i]) && ((j - i) < 128)) j++;
+    if ((j - i) >= 2) {
+      payload[payload_len++] = 0x80 | (j - i - 1);
+      payload[payload_len++] = px[i] & 0xFF;
+      payload[payload_len++] = px[i] >> 8;
+      i = j;
+    }
+    else {
+      j = i;
+      while ((j < n) && ((j - i) < 128) && !(((j + 1) < n) && (px[j + 1] == px[j]))) j++;
+      if (j == i) j++;
+      payload[payload_len++] = j - i - 1;
+      for (; i < j; i++) {
+        payload[payload_len++] = px[i] & 0xFF;
+        payload[payload_len++] = px[i] >> 8;
+      }
+    }
+  }
+}
+
+
+// Once a frame has landed, so has this rect of it.
+static void landed(uint8_t col, uint8_t row, uint8_t w, uint8_t h) {
+  for (uint8_t r = row; r < row + h; r++) {
+    for (uint8_t c = col; c < col + w; c++) shown[r][c] = frame[r][c];
+  }
+}
+
+
+// Redraws everything that ought to be shown, as set_logo() would. True if nothing changed.
+static bool panel_ok() {
+  uint32_t drawn = matrix.checksum();
+  for (uint8_t r = 0; r < TEST_H; r++) {
+    for (uint8_t c = 0; c < TEST_W; c++) matrix.drawPixel(r, (TEST_W - 1) - c, shown[r][c]);
+  }
+  return (drawn == matrix.checksum());
+}
+
+
+// True if the pending ack is for this seq, and does or doesn't ask for a keyframe.
+static bool acked(uint8_t seq, bool want_key) {
+  StringBuilder ack;
+  char expect[40];
+  snprintf(expect, sizeof(expect), "ATCHVAR 8 %u,%u,%u\r\n", seq, want_key ? FRAME_STREAM_ACK_WANT_KEY : 0, FRAME_STREAM_WINDOW);
+  if (!fs.ackPending()) return false;
+  fs.writeAck(&ack);
+  return (0 == strcmp((char*) ack.string(), expect));
+}
+
+
+// Long repeats up top, every pixel different in the middle, short runs at the bottom.
+static void paint(uint16_t salt) {
+  for (uint8_t r = 0; r < TEST_H; r++) {
+    for (uint8_t c = 0; c < TEST_W; c++) {
+      if (r < 16)       frame[r][c] = 0x1111 * ((r + salt) & 0x0F);
+      else if (r < 48)  frame[r][c] = (uint16_t) ((r * 977) ^ (c * 131) ^ salt);
+      else              frame[r][c] = (((c / 3) + salt) & 1) ? 0xF800 : 0x07E0;
+    }
+  }
+}
+
+
+// Plays a file of packets, and checks each frame against logo_wipe's.
+static void play_file(const char* path) {
+  const char* seq[] = {digilent_logo, manuvr_logo, microchip_logo};
+  FILE* fp = fopen(path, "rb");
+  check(NULL != fp, "The stream opens");
+  if (NULL == fp) return;
+  uint32_t frames = 0;
+  uint32_t wrong  = 0;
+  uint32_t text   = 0;
+  uint32_t shown0 = file_fs.frames_shown;
+  uint32_t key0   = file_fs.keyframes;
+  uint32_t bad0   = file_fs.corrupt + file_fs.dropped;
+  int c;
+  while (EOF != (c = fgetc(fp))) {
+    if (!file_fs.accept((uint8_t) c, now_ms)) text++;
+    if (file_fs.frameLanded()) {
+      uint16_t f = frames % 45;
+      uint16_t* from = (uint16_t*) seq[(f / 15) % 3];
+      uint16_t* to   = (uint16_t*) seq[((f / 15) + 1) % 3];
+      uint8_t  wiped = ((f % 15) < 4) ? 0 : (((f % 15) - 3) * 8);
+      for (uint16_t a = 0; a < TEST_W * TEST_H; a++) {
+        shown[a / TEST_W][a % TEST_W] = ((a % TEST_W) < wiped) ? to[a] : from[a];
+      }
+      if (!panel_ok()) wrong++;
+      frames++;
+      now_ms += 80;
+    }
+    if (file_fs.ackPending()) {
+      StringBuilder ack;
+      file_fs.writeAck(&ack);
+    }
+  }
+  fclose(fp);
+  printf("\t(%u frames, %u of them keyframes)\n", file_fs.frames_shown - shown0, file_fs.keyframes - key0);
+  check((90 == frames) && (0 == text), "Every frame in the stream lands, and nothing is text");
+  check(0 == wrong, "...looking as logo_wipe does");
+  check(bad0 == (file_fs.corrupt + file_fs.dropped), "...with nothing dropped or corrupt");
+}
+
+
+int main(int argc, char** argv) {
+  const uint8_t abcde[] = {'a', 'b', 'c', 'd', 'e'};
+  check(0xC8F0 == fletcher16(abcde, 5), "Fletcher-16 of \"abcde\" is 0xC8F0");
+
+  // Text, and a frame period.
+  check(12 == send_text("ATCHVAR 1 2\n"), "Text passes through");
+  payload[0] = 50;
+  payload[1] = 0;
+  payload_len = 2;
+  make_packet(FRAME_STREAM_TYPE_PARAMS, 0);
+  check((0 == send_packet()) && acked(0, false), "A params packet is taken and acked");
+
+  // A delta before there is anything to lay it over.
+  paint(0);
+  payload_len = 0;
+  add_rect(0, 0, 8, 8);
+  make_packet(FRAME_STREAM_TYPE_DELTA, 1);
+  send_packet();
+  check(!fs.frameLanded() && (1 == fs.dropped) && acked(1, true), "A delta with no base is dropped, and a keyframe asked for");
+
+  // A keyframe, in four bands.
+  payload_len = 0;
+  for (uint8_t r = 0; r < TEST_H; r += 16) add_rect(0, r, TEST_W, 16);
+  make_packet(FRAME_STREAM_TYPE_KEY, 2);
+  check((0 == send_packet()) && fs.frameLanded() && acked(2, false), "A keyframe lands");
+  landed(0, 0, TEST_W, TEST_H);
+  check(panel_ok(), "...with every run where it should be");
+
+  // A delta.
+  paint(5);
+  payload_len = 0;
+  add_rect(16, 8, 24, 16);
+  add_rect(88, 56, 8, 8);
+  make_packet(FRAME_STREAM_TYPE_DELTA, 3);
+  check((0 == send_packet()) && fs.frameLanded() && acked(3, false), "A delta lands");
+  landed(16, 8, 24, 16);
+  landed(88, 56, 8, 8);
+  check(panel_ok() && (1 == fs.deltas), "...over the keyframe");
+
+  // Broken, a byte at a time. Nothing of them is drawn.
+  paint(9);
+  payload_len = 0;
+  add_rect(0, 0, TEST_W, 32);
+  make_packet(FRAME_STREAM_TYPE_DELTA, 4);
+  pkt[pkt_len - 1] ^= 0x01;
+  send_packet();
+  check(!fs.frameLanded() && (1 == fs.corrupt) && acked(4, true), "A bad checksum is refused, and a keyframe asked for");
+  check(panel_ok(), "...and nothing of it is drawn");
+  payload_len = 0;
+  for (uint8_t r = 0; r < TEST_H; r += 16) add_rect(0, r, TEST_W, 16);
+  make_packet(FRAME_STREAM_TYPE_KEY, 5);
+  pkt[100] ^= 0x40;
+  send_packet();
+  check(!fs.frameLanded() && (2 == fs.corrupt) && panel_ok(), "So is a keyframe with a bad byte in the payload");
+  payload_len = 0;
+  add_rect(0, 0, TEST_W, 32);
+  make_packet(FRAME_STREAM_TYPE_DELTA, 6);
+  send_packet();
+  check(!fs.frameLanded() && (2 == fs.dropped) && acked(6, true), "Deltas after them are dropped, until...");
+  make_packet(FRAME_STREAM_TYPE_KEY, 7);
+  send_packet();
+  check(!fs.frameLanded() && (3 == fs.corrupt) && acked(7, true), "...a keyframe that doesn't cover the image isn't a base");
+  landed(0, 0, TEST_W, 32);
+  check(panel_ok(), "...but is drawn");
+  paint(0);
+  payload_len = 0;
+  for (uint8_t r = 0; r < TEST_H; r += 16) add_rect(0, r, TEST_W, 16);
+  make_packet(FRAME_STREAM_TYPE_KEY, 8);
+  send_packet();
+  landed(0, 0, TEST_W, TEST_H);
+  check(fs.frameLanded() && acked(8, false) && panel_ok(), "...and a whole one is");
+
+  // Well-formed on the wire, but not as a rect list.
+  payload_len = 0;
+  add_rect(0, 0, 4, 1);
+  payload[4] = 0x84;   // A run of five, in a rect of four.
+  make_packet(FRAME_STREAM_TYPE_DELTA, 9);
+  send_packet();
+  check(!fs.frameLanded() && (4 == fs.corrupt) && acked(9, true), "A run longer than its rect is refused");
+  const uint8_t off_edge[] = {90, 0, 8, 8, 0xBF, 0x00, 0x00};   // Eight wide, from column 90.
+  memcpy(payload, off_edge, sizeof(off_edge));
+  payload_len = sizeof(off_edge);
+  make_packet(FRAME_STREAM_TYPE_KEY, 10);
+  send_packet();
+  check(!fs.frameLanded() && (5 == fs.corrupt) && acked(10, true), "...and so is a rect off the edge of the image");
+
+  // A lost frame.
+  payload_len = 0;
+  for (uint8_t r = 0; r < TEST_H; r += 16) add_rect(0, r, TEST_W, 16);
+  make_packet(FRAME_STREAM_TYPE_KEY, 11);
+  send_packet();
+  check(fs.frameLanded() && acked(11, false), "Back on a keyframe");
+  paint(3);
+  payload_len = 0;
+  add_rect(40, 40, 8, 8);
+  make_packet(FRAME_STREAM_TYPE_DELTA, 13);
+  send_packet();
+  check(!fs.frameLanded() && (4 == fs.dropped) && acked(13, true), "A gap in seqs drops the lost frame, and the delta after");
+
+  // A stall partway through. Whatever is left of it must not reach the text parser.
+  paint(0);
+  payload_len = 0;
+  for (uint8_t r = 0; r < TEST_H; r += 16) add_rect(0, r, TEST_W, 16);
+  make_packet(FRAME_STREAM_TYPE_KEY, 14);
+  uint32_t skipped = fs.skipped;
+  uint32_t text = send(pkt, 1000);
+  now_ms += FRAME_STREAM_TIMEOUT + 1;
+  text += send(&pkt[1000], pkt_len - 1000);
+  check((0 == text) && !fs.frameLanded() && (6 == fs.corrupt), "A packet that stalls is abandoned");
+  check((pkt_len - 1000) == (fs.skipped - skipped), "...and what's left of it is skipped, to the byte");
+  check(acked(14, true), "...and a keyframe asked for");
+  check(12 == send_text("ATCHVAR 1 2\n"), "Text after it passes through");
+
+  // A bad header. We can't know how long it was, so skip to the next sync.
+  skipped = fs.skipped;
+  const uint8_t junk[] = {FRAME_STREAM_SYNC, 0x09, 'A', 'T', 'C', 'H', '\n', 0x00, 0x80};
+  text = send(junk, sizeof(junk));
+  check((0 == text) && (7 == fs.corrupt), "A bad packet type is abandoned");
+  make_packet(FRAME_STREAM_TYPE_KEY, 15);
+  check(0 == send_packet(), "...and everything up to the next sync is skipped");
+  check(((sizeof(junk) - 2) == (fs.skipped - skipped)) && fs.frameLanded() && acked(15, false), "...and the packet there lands");
+  text = send(junk, sizeof(junk));
+  now_ms += FRAME_STREAM_TIMEOUT + 1;
+  check(12 == send_text("ATCHVAR 1 2\n"), "Text passes once the link has been quiet a while");
+
+  if (argc > 1) play_file(argv[1]);
+
+  StringBuilder output;
+  fs.printDebug(&output);
+  printf("%s\n", (char*) output.string());
+  if (failures) {
+    printf("FAIL: %u checks.\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,133 @@
+/*
+File:   gesture_queue_test.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+GestureQueue, off the board.
+
+    gesture_queue_test
+
+Checks that:
+  - A run of positions comes out as the newest of them.
+  - Taps, swipes and the rest are all kept, in order, and so is the position on
+    either side of one.
+  - A full queue turns away the newest gesture and counts it, unless it's a
+    position that can take the place of the last one.
+  - The order holds once the queue has wrapped around.
+
+Exits non-zero if any of them don't hold.
+*/
+
+#include "Arduino.h"
+#include "GestureQueue.h"
+#include <StringBuilder.h>
+
+static uint8_t  failures = 0;
+static uint32_t stamp    = 0;
+
+
+static void check(bool ok, const char* what) {
+  printf("\t%-58s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok) failures++;
+}
+
+
+// Posts a gesture. Positions carry their value in x, so they can be told apart.
+static bool post(GestureQueue* q, uint8_t kind, int32_t value) {
+  LuxGesture g;
+  g.kind   = kind;
+  g.value  = value;
+  g.pos[0] = 0;
+  g.pos[1] = (uint16_t) value;
+  g.pos[2] = 0;
+  g.stamp  = stamp++;
+  return q->post(&g);
+}
+
+
+// True if the next gesture out is of the given kind and value.
+static bool next_is(GestureQueue* q, uint8_t kind, int32_t value) {
+  LuxGesture g;
+  if (!q->take(&g)) return false;
+  if (kind != g.kind) return false;
+  return (GESTURE_POSITION == kind) ? (value == g.pos[1]) : (value == g.value);
+}
+
+
+int main() {
+  GestureQueue q;
+  LuxGesture   g;
+
+  check(!q.take(&g), "Nothing to take from an empty queue");
+
+  for (int32_t i = 0; i < 10; i++) post(&q, GESTURE_POSITION, 100 + i);
+  check(1 == q.count(), "A run of positions takes one place");
+  check(9 == q.coalesced, "...and the rest are counted as coalesced");
+  check(next_is(&q, GESTURE_POSITION, 109), "...and it's the newest");
+
+  // A tap between two runs of positions.
+  post(&q, GESTURE_POSITION, 1);
+  post(&q, GESTURE_POSITION, 2);
+  post(&q, GESTURE_TAP, 7);
+  post(&q, GESTURE_POSITION, 3);
+  post(&q, GESTURE_POSITION, 4);
+  post(&q, GESTURE_SWIPE, 8);
+  post(&q, GESTURE_SWIPE, 9);
+  post(&q, GESTURE_POSITION, 5);
+  check(6 == q.count(), "Positions either side of other gestures are kept");
+  check(next_is(&q, GESTURE_POSITION, 2), "The position the tap came at...");
+  check(next_is(&q, GESTURE_TAP, 7), "...then the tap...");
+  check(next_is(&q, GESTURE_POSITION, 4), "...then the newest position after it");
+  check(next_is(&q, GESTURE_SWIPE, 8), "Two swipes in a row...");
+  check(next_is(&q, GESTURE_SWIPE, 9), "...are both kept, in order");
+  check(next_is(&q, GESTURE_POSITION, 5), "The last position is there too");
+  check(0 == q.count(), "...and that's all");
+
+  // Filling up. The head is partway around the ring by now.
+  bool took = true;
+  for (int32_t i = 0; i < GESTURE_QUEUE_SIZE - 1; i++) {
+    took &= post(&q, (i & 1) ? GESTURE_TAP : GESTURE_AIRWHEEL, i);
+  }
+  took &= post(&q, GESTURE_POSITION, 50);
+  check(took && (GESTURE_QUEUE_SIZE == q.count()), "Takes as many gestures as it has room for");
+  check(post(&q, GESTURE_POSITION, 51), "When full, a position still replaces the last one");
+  check(!post(&q, GESTURE_TOUCH, 1), "...but anything else is turned away");
+  check(1 == q.dropped, "...and counted as dropped");
+  bool ordered = true;
+  for (int32_t i = 0; i < GESTURE_QUEUE_SIZE - 1; i++) {
+    ordered &= next_is(&q, (i & 1) ? GESTURE_TAP : GESTURE_AIRWHEEL, i);
+  }
+  check(ordered, "Everything comes out in order, across the wrap");
+  check(next_is(&q, GESTURE_POSITION, 51), "...with the newest position last");
+  check(!q.take(&g), "...and nothing after it");
+
+  // A full queue of discrete gestures doesn't take a position.
+  for (int32_t i = 0; i < GESTURE_QUEUE_SIZE; i++) post(&q, GESTURE_TAP, i);
+  check(!post(&q, GESTURE_POSITION, 60), "A position after a full run of taps is turned away");
+  check(2 == q.dropped, "...and counted as dropped");
+
+  StringBuilder output;
+  q.printDebug(&output);
+  printf("%s\n", (char*) output.string());
+  if (failures) {
+    printf("FAIL: %u checks.\n", failures);
+    return 1;
+  }
+  return 0;
+}
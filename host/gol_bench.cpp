@@ -0,0 +1,317 @@
+/*
+File:   gol_bench.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+GoLBoard against the life() it replaced, off the board.
+
+    gol_bench [generations]
+
+life() is as the sketch had it, with a board of ints. Both are seeded the same, and
+  stepped together, over the Moore neighborhood and then the Von Neumann. Every
+  generation has to come out the same in both. Exits non-zero at the first one that
+  doesn't. Then each is timed on its own.
+
+The period GoLBoard finds from its hashes is held up against one found the slow
+  way, by comparing the whole board to every generation still in its history. They
+  have to agree every generation, on the random boards as they settle, and on a
+  blinker and a block set down on an empty board.
+
+Last, the other rules GoLBoard knows (see LifeRule.h) are held up against a plain
+  reference that reads the rule's count sets cell by cell. Both the rules built in
+  as fixed logic and ones only compiled at runtime are run, Generations rules among
+  them, and every cell's dying age has to match as well as whether it is alive.
+  These run for RULE_GENERATIONS at most, as the reference is slow.
+
+With every rule, each cell whose state changed has to have been flagged for the
+  renderer to redraw. The sketch only draws what is flagged, so a cell that changed
+  without a flag would be left wrong on the panel.
+
+This is built with the board at the panel's size (96x64), as life() had it, and
+  again at the sketch's 512x512. Any size GoLBoard takes will do.
+*/
+
+#include "Arduino.h"
+#include "GoLBoard.h"
+#include "LifeRule.h"
+#include <string.h>
+
+#define BENCH_GENERATIONS  500
+#define RULE_GENERATIONS   500    // At most, for each of the other rules.
+
+static GoLBoard board;
+static int      old_board[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH];
+static int      before[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH];   // old_board, a generation back.
+
+// The boards before this one, for finding periods the slow way.
+static uint32_t history[GOL_HASH_HISTORY][GOL_BOARD_HEIGHT][GOL_WORDS_PER_ROW];
+static uint8_t  hist_idx   = 0;
+static uint8_t  hist_depth = 0;
+
+
+/*
+* As it was in the sketch, less the comments. The board wraps at every edge.
+*/
+static void copy(int array1[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH], int array2[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH]) {
+  for (int j = 0; j < GOL_BOARD_HEIGHT; j++) {
+    for (int i = 0; i < GOL_BOARD_WIDTH; i++) {
+      array2[j][i] = array1[j][i];
+    }
+  }
+}
+
+static void life(int array[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH], char choice) {
+  static int temp[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH];
+  copy(array, temp);
+  for (int j = GOL_BOARD_HEIGHT; j < (GOL_BOARD_HEIGHT*2); j++) {
+    for (int i = GOL_BOARD_WIDTH; i < (GOL_BOARD_WIDTH*2); i++) {
+      int count = 0;
+      if (choice == 'm') {
+        count = array[(j-1)%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] +
+          array[(j-1)%GOL_BOARD_HEIGHT][(i-1) % GOL_BOARD_WIDTH] +
+          array[j%GOL_BOARD_HEIGHT][(i-1) % GOL_BOARD_WIDTH] +
+          array[(j+1)%GOL_BOARD_HEIGHT][(i-1) % GOL_BOARD_WIDTH] +
+          array[(j+1)%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] +
+          array[(j+1)%GOL_BOARD_HEIGHT][(i+1) % GOL_BOARD_WIDTH] +
+          array[j%GOL_BOARD_HEIGHT][(i+1) % GOL_BOARD_WIDTH] +
+          array[(j-1)%GOL_BOARD_HEIGHT][(i+1) % GOL_BOARD_WIDTH];
+      }
+      else if (choice == 'v') {
+        count = array[(j-1)%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] +
+          array[j%GOL_BOARD_HEIGHT][(i-1) % GOL_BOARD_WIDTH] +
+          array[(j+1)%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] +
+          array[j%GOL_BOARD_HEIGHT][(i+1) % GOL_BOARD_WIDTH];
+      }
+      if (count < 2 || count > 3) temp[j%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] = 0;
+      else if (count == 2) temp[j%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] = array[j%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH];
+      else if (count == 3) temp[j%GOL_BOARD_HEIGHT][i % GOL_BOARD_WIDTH] = 1;
+    }
+  }
+  copy(temp, array);
+}
+
+
+/*
+* Any rule, one cell at a time. States are as LifeRule.h has them: 0 is dead, 1 is
+*   alive, and anything more is dying.
+*/
+static void ref_life(int array[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH], const LifeRule* rule) {
+  static int temp[GOL_BOARD_HEIGHT][GOL_BOARD_WIDTH];
+  for (int j = 0; j < GOL_BOARD_HEIGHT; j++) {
+    for (int i = 0; i < GOL_BOARD_WIDTH; i++) {
+      int count = 0;
+      for (int dj = -1; dj <= 1; dj++) {
+        for (int di = -1; di <= 1; di++) {
+          if ((0 == dj) && (0 == di)) continue;
+          if ((LIFE_NEIGHBORS_VN == rule->neighborhood) && (0 != dj) && (0 != di)) continue;
+          int r = (j + dj + GOL_BOARD_HEIGHT) % GOL_BOARD_HEIGHT;
+          int c = (i + di + GOL_BOARD_WIDTH) % GOL_BOARD_WIDTH;
+          if (1 == array[r][c]) count++;
+        }
+      }
+      int state = array[j][i];
+      if (0 == state) {
+        temp[j][i] = ((rule->birth >> count) & 1) ? 1 : 0;
+      }
+      else if (1 == state) {
+        temp[j][i] = ((rule->survive >> count) & 1) ? 1 : ((rule->states > 2) ? 2 : 0);
+      }
+      else {
+        temp[j][i] = (state + 1) % rule->states;
+      }
+    }
+  }
+  copy(temp, array);
+}
+
+
+static void seed(const char* rulestring) {
+  LifeRule rule;
+  rule.parse(rulestring);
+  board.setRule(&rule);
+  srand(0x4C7578);
+  board.randomize();
+  hist_depth = 0;   // As the board forgets its hashes.
+  for (int j = 0; j < GOL_BOARD_HEIGHT; j++) {
+    for (int i = 0; i < GOL_BOARD_WIDTH; i++) {
+      old_board[j][i] = board.alive(j, i) ? 1 : 0;
+    }
+  }
+}
+
+
+// As compare(), but of every cell's state, dying ones included.
+static int32_t compare_states() {
+  for (int j = 0; j < GOL_BOARD_HEIGHT; j++) {
+    for (int i = 0; i < GOL_BOARD_WIDTH; i++) {
+      int state = board.alive(j, i) ? 1 : 0;
+      if (board.age(j, i)) state = board.age(j, i) + 1;
+      if (old_board[j][i] != state) return (j * GOL_BOARD_WIDTH) + i;
+    }
+  }
+  return -1;
+}
+
+
+/*
+* The first cell that changed since before[] without being flagged for a redraw, as
+*   compare() has it. Flags are cleared after, as the renderer would.
+*/
+static int32_t redraw_missed() {
+  int32_t ret = -1;
+  for (int j = 0; (ret < 0) && (j < GOL_BOARD_HEIGHT); j++) {
+    uint32_t dirty = board.dirtyWords(j);
+    for (int i = 0; i < GOL_BOARD_WIDTH; i++) {
+      if ((before[j][i] != old_board[j][i]) && !((dirty >> (i >> 5)) & 1)) {
+        ret = (j * GOL_BOARD_WIDTH) + i;
+        break;
+      }
+    }
+  }
+  board.clearRedraw();
+  return ret;
+}
+
+
+/*
+* Steps the board, keeping what it was beforehand. Returns the period of the cycle
+*   it is in, by the whole board, or 0 if none of the boards kept match it.
+*/
+static uint8_t step_and_find_period() {
+  for (int j = 0; j < GOL_BOARD_HEIGHT; j++) {
+    memcpy(history[hist_idx][j], board.row(j), sizeof(history[0][0]));
+  }
+  hist_idx = (hist_idx + 1) % GOL_HASH_HISTORY;
+  if (hist_depth < GOL_HASH_HISTORY) hist_depth++;
+  board.step();
+
+  for (uint8_t p = 1; p <= hist_depth; p++) {
+    uint8_t h = (hist_idx + GOL_HASH_HISTORY - p) % GOL_HASH_HISTORY;
+    bool    same = true;
+    for (int j = 0; same && (j < GOL_BOARD_HEIGHT); j++) {
+      same = (0 == memcmp(history[h][j], board.row(j), sizeof(history[0][0])));
+    }
+    if (same) return p;
+  }
+  return 0;
+}
+
+
+// The first cell that differs, as row * width + col. -1 if none do.
+static int32_t compare() {
+  for (int j = 0; j < GOL_BOARD_HEIGHT; j++) {
+    for (int i = 0; i < GOL_BOARD_WIDTH; i++) {
+      if (old_board[j][i] != (board.alive(j, i) ? 1 : 0)) return (j * GOL_BOARD_WIDTH) + i;
+    }
+  }
+  return -1;
+}
+
+
+int main(int argc, char** argv) {
+  uint32_t gens = (argc > 1) ? strtoul(argv[1], NULL, 10) : BENCH_GENERATIONS;
+  if (0 == gens) gens = 1;
+
+  const char  choices[]    = { 'm', 'v' };
+  const char* rulestrings[] = { "B3/S23", "B3/S23V" };
+  printf("%ux%u board, %u generations.\n", GOL_BOARD_WIDTH, GOL_BOARD_HEIGHT, gens);
+
+  for (uint8_t n = 0; n < 2; n++) {
+    seed(rulestrings[n]);
+    uint32_t cycling = 0;
+    for (uint32_t g = 0; g < gens; g++) {
+      copy(old_board, before);
+      life(old_board, choices[n]);
+      uint8_t period = step_and_find_period();
+      int32_t cell = compare();
+      if (cell < 0) cell = redraw_missed();
+      if (cell >= 0) {
+        printf("%s: generation %u differs at (%d, %d), or wasn't flagged.\n", rulestrings[n], g + 1, cell / GOL_BOARD_WIDTH, cell % GOL_BOARD_WIDTH);
+        return 1;
+      }
+      if (period != board.period()) {
+        printf("%s: generation %u has a period of %u, not the %u the hashes found.\n", rulestrings[n], g + 1, period, board.period());
+        return 1;
+      }
+      if (period) cycling++;
+    }
+
+    seed(rulestrings[n]);
+    uint32_t t0 = micros();
+    for (uint32_t g = 0; g < gens; g++) life(old_board, choices[n]);
+    uint32_t old_us = (micros() - t0) | 1;
+
+    t0 = micros();
+    for (uint32_t g = 0; g < gens; g++) board.step();
+    uint32_t new_us = (micros() - t0) | 1;
+
+    printf("%s: all %u generations match and were flagged, and their periods (%u of them in a cycle).\n", rulestrings[n], gens, cycling);
+    printf("\tlife():    %6u ns/generation\n", (uint32_t) (((uint64_t) old_us * 1000) / gens));
+    printf("\tGoLBoard:  %6u ns/generation (%u evaluated tiles of %u)\n",
+      (uint32_t) (((uint64_t) new_us * 1000) / gens), board.tiles_evaluated / (board.generation | 1), GOL_TILE_COUNT);
+  }
+
+  // A blinker, and then a block, on their own. Their periods are known.
+  const uint8_t want[] = { 2, 1 };
+  for (uint8_t n = 0; n < 2; n++) {
+    seed("B3/S23");
+    board.clear();
+    board.set(10, 10);
+    board.set(10, 11);
+    if (0 == n) board.set(10, 12);
+    else {
+      board.set(11, 10);
+      board.set(11, 11);
+    }
+    for (uint32_t g = 0; g < 20; g++) {
+      uint8_t period = step_and_find_period();
+      if ((period != board.period()) || ((g + 1 >= want[n]) && (want[n] != period))) {
+        printf("%s: generation %u has a period of %u by the board, and %u by the hashes. It should be %u.\n",
+          (0 == n) ? "Blinker" : "Block", g + 1, period, board.period(), want[n]);
+        return 1;
+      }
+    }
+    printf("%s: period %u, as it should be.\n", (0 == n) ? "Blinker" : "Block", board.period());
+  }
+
+  // The first four are built in. The rest are only compiled.
+  const char* others[] = { "B36/S23", "B3678/S34678", "B2/S/C3", "B2/S345/C4", "B35/S236/C5", "B2/S13/C4V", "B34/S34V" };
+  for (uint8_t n = 0; n < (sizeof(others) / sizeof(others[0])); n++) {
+    LifeRule rule;
+    if (rule.parse(others[n])) {
+      printf("%s: didn't parse.\n", others[n]);
+      return 1;
+    }
+    seed(others[n]);
+    uint32_t rule_gens = (gens < RULE_GENERATIONS) ? gens : RULE_GENERATIONS;
+    for (uint32_t g = 0; g < rule_gens; g++) {
+      copy(old_board, before);
+      ref_life(old_board, &rule);
+      board.step();
+      int32_t cell = compare_states();
+      if (cell < 0) cell = redraw_missed();
+      if (cell >= 0) {
+        printf("%s: generation %u differs at (%d, %d), or wasn't flagged.\n", others[n], g + 1, cell / GOL_BOARD_WIDTH, cell % GOL_BOARD_WIDTH);
+        return 1;
+      }
+    }
+    printf("%s: all %u generations match, and were flagged.\n", others[n], rule_gens);
+  }
+  return 0;
+}
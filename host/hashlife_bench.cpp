@@ -0,0 +1,95 @@
+/*
+File:   hashlife_bench.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+HashLife against the plain stepper, off the board.
+
+    hashlife_bench [log2_gens] [settle_gens]
+
+Seeds a board as the sketch does, steps it settle_gens generations the plain way
+  (a fresh board is the worst case for HashLife, and a settled one the best), and
+  then takes it 2^log2_gens generations further, both ways. The two boards must come
+  out the same. Exits non-zero if they don't.
+
+The pool is the sketch's own. A jump too big for it is reported as such, and isn't
+  an error here. The sketch steps the board instead. The tests look for "Boards
+  match", so that a jump the sketch makes can't quietly stop fitting.
+*/
+
+#include "Arduino.h"
+#include "GoLBoard.h"
+#include "HashLife.h"
+#include <StringBuilder.h>
+
+static GoLBoard plain;
+static GoLBoard jumped;
+static HashLife hashlife;
+
+
+int main(int argc, char** argv) {
+  uint8_t  log2_gens = (argc > 1) ? atoi(argv[1]) : 10;
+  uint32_t settle    = (argc > 2) ? strtoul(argv[2], NULL, 10) : 0;
+  if (log2_gens > HASHLIFE_MAX_JUMP) log2_gens = HASHLIFE_MAX_JUMP;
+
+  // The same seed makes the same board.
+  srand(0x4C7578);
+  plain.randomize();
+  srand(0x4C7578);
+  jumped.randomize();
+  for (uint32_t i = 0; i < settle; i++) {
+    plain.step();
+    jumped.step();
+  }
+
+  uint32_t gens = (uint32_t) 1 << log2_gens;
+  uint32_t t0 = micros();
+  for (uint32_t i = 0; i < gens; i++) plain.step();
+  uint32_t plain_us = micros() - t0;
+
+  if (hashlife.init()) {
+    printf("No memory for HashLife.\n");
+    return 1;
+  }
+  t0 = micros();
+  int8_t ret = hashlife.jump(&jumped, log2_gens);
+  uint32_t jump_us = micros() - t0;
+
+  printf("%ux%u board, settled %u generations, then %u more.\n", GOL_BOARD_WIDTH, GOL_BOARD_HEIGHT, settle, gens);
+  printf("\tStepped:   %uus (%uus/generation)\n", plain_us, plain_us / gens);
+  if (ret) {
+    printf("\tHashLife:  couldn't jump (%d) in %uus\n", ret, jump_us);
+  }
+  else {
+    printf("\tHashLife:  %uus (%u.%02ux)\n", jump_us, plain_us / (jump_us | 1), ((plain_us % (jump_us | 1)) * 100) / (jump_us | 1));
+  }
+  StringBuilder output;
+  hashlife.printDebug(&output);
+  printf("%s\n", (char*) output.string());
+  if (ret) return 0;   // Not wrong, just too big for the pool. The sketch steps instead.
+
+  for (uint16_t r = 0; r < GOL_BOARD_HEIGHT; r++) {
+    if (memcmp(plain.row(r), jumped.row(r), GOL_WORDS_PER_ROW * sizeof(uint32_t))) {
+      printf("Boards differ at row %u.\n", r);
+      return 1;
+    }
+  }
+  printf("Boards match.\n");
+  return 0;
+}
@@ -0,0 +1,148 @@
+/*
+File:   line_ring_test.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+LineRing, off the board.
+
+    line_ring_test
+
+Checks that:
+  - Lines come out whole and in order, as one run of bytes, after the ring has
+    wrapped around many times and with lines straddling its end.
+  - A carriage return before the newline is left off.
+  - The longest line the ring allows is kept, and one a byte longer is thrown away
+    whole, without taking the lines either side of it along.
+  - A line that loses bytes to a full ring is thrown away whole, the lines before
+    it are still there, and the ring takes lines again once they're read.
+
+Exits non-zero if any of them don't hold.
+*/
+
+#include "Arduino.h"
+#include "LineRing.h"
+#include <StringBuilder.h>
+#include <string.h>
+
+static uint8_t failures = 0;
+
+
+static void check(bool ok, const char* what) {
+  printf("\t%-58s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok) failures++;
+}
+
+
+// Pushes a whole string. Returns the number of bytes the ring turned away.
+static uint16_t push_str(LineRing* ring, const char* str, uint16_t len) {
+  uint16_t lost = 0;
+  for (uint16_t i = 0; i < len; i++) {
+    if (!ring->push((uint8_t) str[i])) lost++;
+  }
+  return lost;
+}
+
+
+// True if the next line out of the ring is the one given.
+static bool next_is(LineRing* ring, const char* want) {
+  const char* line;
+  uint16_t    len;
+  if (!ring->nextLine(&line, &len)) return false;
+  return (len == strlen(want)) && (0 == memcmp(line, want, len)) && ('\0' == line[len]);
+}
+
+
+int main() {
+  LineRing ring;
+  char     buf[LINE_RING_SIZE * 2];
+  char     want[LINE_RING_SIZE * 2];
+
+  // Lines of a length that doesn't divide the ring, so that they straddle its end.
+  bool     whole = true;
+  uint32_t count = 0;
+  for (uint16_t i = 0; i < 200; i++) {
+    int n = snprintf(buf, sizeof(buf), "ATCHVAR 1 %u,%u,%u%s\n", i, i * 7, i * 13, (i & 1) ? "\r" : "");
+    whole &= (0 == push_str(&ring, buf, n));
+    if (i % 3 == 2) {
+      // Read in bursts, so there is more than one line waiting at times.
+      for (uint16_t j = i - 2; j <= i; j++) {
+        snprintf(want, sizeof(want), "ATCHVAR 1 %u,%u,%u", j, j * 7, j * 13);
+        if (next_is(&ring, want)) count++;
+      }
+    }
+  }
+  check(whole, "No bytes lost while the reader keeps up");
+  check(198 == count, "Lines come out whole and in order, across the wrap");
+  check(true == next_is(&ring, "ATCHVAR 1 198,1386,2574"), "...including the ones left over");
+  check(true == next_is(&ring, "ATCHVAR 1 199,1393,2587"), "...with the carriage return left off");
+  check(!next_is(&ring, ""), "Nothing is left");
+  check(0 == ring.pending(), "...and nothing is pending");
+
+  // The longest line there is room for, and one a byte longer.
+  memset(buf, 'x', LINE_RING_MAX_LINE + 1);
+  buf[LINE_RING_MAX_LINE] = '\n';
+  check(0 == push_str(&ring, buf, LINE_RING_MAX_LINE + 1), "The longest line is taken...");
+  memcpy(want, buf, LINE_RING_MAX_LINE);
+  want[LINE_RING_MAX_LINE] = '\0';
+  check(next_is(&ring, want), "...and read back whole");
+
+  uint32_t discarded = ring.discarded;
+  push_str(&ring, "before\n", 7);
+  check(next_is(&ring, "before"), "The line before it is kept");
+  memset(buf, 'y', LINE_RING_MAX_LINE + 1);
+  buf[LINE_RING_MAX_LINE + 1] = '\n';
+  check(1 == push_str(&ring, buf, LINE_RING_MAX_LINE + 2), "A byte longer loses a byte...");
+  check(!next_is(&ring, ""), "...and is thrown away whole");
+  check((discarded + 1) == ring.discarded, "...and counted as discarded");
+  push_str(&ring, "after\n", 6);
+  check(next_is(&ring, "after"), "The line after it is kept");
+
+  // Fill the ring with whole lines, then run it out of room partway into one more.
+  discarded = ring.discarded;
+  uint16_t full_lines = 0;
+  while (ring.pending() + 10 < (LINE_RING_SIZE - 1)) {
+    snprintf(buf, sizeof(buf), "line %03u\n", full_lines++);
+    push_str(&ring, buf, 9);
+  }
+  uint32_t dropped = ring.dropped;
+  check(0 != push_str(&ring, "this one won't ", 15), "A full ring turns bytes away");
+  check(dropped < ring.dropped, "...and counts them as dropped");
+
+  bool ordered = true;
+  for (uint16_t i = 0; i < full_lines; i++) {
+    snprintf(want, sizeof(want), "line %03u", i);
+    ordered &= next_is(&ring, want);
+  }
+  check(ordered, "The lines before it are all there");
+  // Now that there's room, the rest of the line comes in. It's still dropped.
+  check(13 == push_str(&ring, "fit in there\r\n", 14), "The rest of the line is dropped, but its newline kept");
+  check(!next_is(&ring, ""), "The line that lost bytes is thrown away whole");
+  check((discarded + 1) == ring.discarded, "...and counted as discarded");
+  push_str(&ring, "back again\r\n", 12);
+  check(next_is(&ring, "back again"), "The ring takes lines again");
+
+  StringBuilder output;
+  ring.printDebug(&output);
+  printf("%s\n", (char*) output.string());
+  if (failures) {
+    printf("FAIL: %u checks.\n", failures);
+    return 1;
+  }
+  return 0;
+}
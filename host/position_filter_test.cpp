@@ -0,0 +1,143 @@
+/*
+File:   position_filter_test.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+PositionFilter against a gesture trace (see LuxTrace.h), off the board.
+
+    position_filter_test <trace>
+
+Reads the positions out of the trace with TraceReader, and plays them into the
+  filter on the trace's own clock, under the gains it was recorded with. At the
+  start of every frame, the filter is asked where the hand will be once the frame
+  is on the panel. The answer is held up against the samples that came in around
+  that time, and so is the last sample, which is what the sketch drew before there
+  was a filter. Errors are in panel pixels, as apply_gesture() maps them.
+
+The filter has to come out closer than the last sample did. Exits non-zero if it
+  doesn't, or if the trace has too few positions to say.
+*/
+
+#include "Arduino.h"
+#include "Atchvar.h"
+#include "LuxTrace.h"
+#include "PositionFilter.h"
+#include <StringBuilder.h>
+#include <math.h>
+
+#define TEST_MAX_SAMPLES    4096
+#define TEST_MIN_SAMPLES      16
+#define TEST_SETTLE_US    200000   // Frames before this aren't counted.
+#define GESTURE_POSITION       1   // As Effect.h has it.
+
+static uint32_t stamps[TEST_MAX_SAMPLES];
+static uint16_t samples[TEST_MAX_SAMPLES][3];
+static uint16_t count = 0;
+
+
+/*
+* Where the hand was at the given time, by the samples either side of it.
+*/
+static void sampled_at(uint32_t t, double* out) {
+  uint16_t i = 1;
+  while ((i < count - 1) && (stamps[i] < t)) i++;
+  double f = ((double) t - stamps[i - 1]) / (double) (stamps[i] - stamps[i - 1]);
+  for (uint8_t a = 0; a < 3; a++) out[a] = samples[i - 1][a] + (f * ((double) samples[i][a] - samples[i - 1][a]));
+}
+
+
+// The panel pixel error, squared, between a position and where the hand was.
+static double error_sq(const uint16_t* pos, const double* truth) {
+  double dx = ((double) pos[1] - truth[1]) / 1024.0;
+  double dy = ((double) pos[0] - truth[0]) / 683.0;
+  return (dx * dx) + (dy * dy);
+}
+
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    printf("Usage: %s <trace>\n", argv[0]);
+    return 1;
+  }
+  TraceReader trace;
+  if (trace.open(argv[1])) {
+    printf("Couldn't read a trace from %s\n", argv[1]);
+    return 1;
+  }
+
+  uint32_t    stamp;
+  const char* line;
+  uint16_t    len;
+  while (trace.next(&stamp, &line, &len) && (count < TEST_MAX_SAMPLES)) {
+    Atchvar msg;
+    if ((0 == parse_atchvar(line, len, &msg)) && (GESTURE_POSITION == msg.var) && (3 == msg.argc)) {
+      stamps[count] = stamp;
+      for (uint8_t a = 0; a < 3; a++) samples[count][a] = (uint16_t) msg.args[a];
+      count++;
+    }
+  }
+  trace.close();
+  if (count < TEST_MIN_SAMPLES) {
+    printf("Only %u positions in %s\n", count, argv[1]);
+    return 1;
+  }
+
+  PositionFilter filter;
+  if (trace.settings) filter.setGains(trace.filter_alpha, trace.filter_beta);
+  printf("%s: %u positions, %uus frames, alpha %u, beta %u\n", argv[1], count, trace.frame_us, filter.alpha(), filter.beta());
+
+  // Frames start on the trace's clock. Stop once the panel time runs past the samples.
+  double   held_sq  = 0.0;
+  double   filt_sq  = 0.0;
+  uint32_t frames   = 0;
+  uint16_t next     = 0;
+  for (uint32_t t = 0; (t + POSITION_FILTER_LEAD_US) < stamps[count - 1]; t += trace.frame_us) {
+    while ((next < count) && (stamps[next] <= t)) {
+      filter.update(samples[next], stamps[next]);
+      next++;
+    }
+    if ((0 == next) || (t < TEST_SETTLE_US)) continue;
+
+    double   truth[3];
+    uint16_t predicted[3];
+    sampled_at(t + POSITION_FILTER_LEAD_US, truth);
+    filter.predict(t, predicted);
+    held_sq += error_sq(samples[next - 1], truth);
+    filt_sq += error_sq(predicted, truth);
+    frames++;
+  }
+  if (0 == frames) {
+    printf("No frames to judge.\n");
+    return 1;
+  }
+
+  double held = sqrt(held_sq / frames);
+  double filt = sqrt(filt_sq / frames);
+  printf("\tFrames:          %u\n", frames);
+  printf("\tLast sample:     %.3f px rms\n", held);
+  printf("\tFiltered:        %.3f px rms\n", filt);
+  StringBuilder output;
+  filter.printDebug(&output);
+  printf("%s\n", (char*) output.string());
+  if (filt >= held) {
+    printf("FAIL: The filter is no closer than the last sample.\n");
+    return 1;
+  }
+  return 0;
+}
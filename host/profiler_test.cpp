@@ -0,0 +1,132 @@
+/*
+File:   profiler_test.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+LuxProfiler, off the board.
+
+    profiler_test
+
+Timings are recorded by hand, in ticks, and read back out of the report. Checks that:
+  - A full scope table refuses the next scope, and ids outside it are ignored.
+  - 0, 1 and 0xFFFFFFFF ticks land in the first and last buckets.
+  - min, mean and max come out as recorded.
+  - A report is written a scope per call, starts the live stats over, and covers
+    the time since the last one.
+  - A LuxProfTimer records into its scope when it goes out of scope.
+Then an empty timer is timed, for what a scope costs here.
+
+Exits non-zero if any of them don't hold.
+*/
+
+#include "Arduino.h"
+#include "LuxProfiler.h"
+#include <StringBuilder.h>
+#include <string.h>
+
+#define TEST_TIMER_RUNS  100000
+
+static uint8_t failures = 0;
+
+
+static void check(bool ok, const char* what) {
+  printf("\t%-58s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok) failures++;
+}
+
+
+// Writes out a whole report. Returns the number of calls that wrote a scope.
+static uint8_t report(LuxProfiler* prof, StringBuilder* output) {
+  uint8_t n = 0;
+  while (prof->reportSome(output)) n++;
+  return n;
+}
+
+
+int main() {
+  LuxProfiler prof;
+  char        names[LUX_PROFILER_MAX_SCOPES][8];
+
+  int8_t a = prof.createScope("alpha");
+  int8_t b = prof.createScope("beta");
+  check((0 == a) && (1 == b), "Scopes are numbered from 0");
+  for (uint8_t i = 2; i < LUX_PROFILER_MAX_SCOPES; i++) {
+    snprintf(names[i], sizeof(names[i]), "s%u", i);
+    prof.createScope(names[i]);
+  }
+  check(-1 == prof.createScope("over"), "A full table refuses the next scope");
+
+  prof.record(a, 0);
+  prof.record(a, 1);
+  prof.record(a, 0xFFFFFFFF);
+  prof.record(b, 150);
+  prof.record(b, 250);
+  prof.record(-1, 5);
+  prof.record(LUX_PROFILER_MAX_SCOPES, 5);
+  check(!prof.reporting(), "Not reporting until asked");
+
+  StringBuilder output;
+  prof.startReport(1500);
+  check(prof.reporting(), "Reporting once asked");
+  check(LUX_PROFILER_MAX_SCOPES == report(&prof, &output), "A scope per call");
+  check(!prof.reporting(), "...and done after the last");
+  const char* text = (const char*) output.string();
+  printf("%s", text);
+  check(NULL != strstr(text, "Profile: 1500ms"), "The first report covers the time since start");
+  check(NULL != strstr(text, "alpha               3 runs"), "Out-of-range ids are ignored");
+  check(NULL != strstr(text, " >=0.01us:2 "), "0 and 1 tick land in the first bucket");
+  check(NULL != strstr(text, " >=21474836.48us:1\n"), "0xFFFFFFFF ticks land in the last");
+  check(NULL != strstr(text, "min 0.00us  mean 14316557.65us  max 42949672.95us"), "min, mean and max are as recorded");
+  check(NULL != strstr(text, "beta                2 runs  min 1.50us  mean 2.00us  max 2.50us"), "...for every scope");
+
+  // The live stats were started over by the report.
+  prof.record(b, 100);
+  output.clear();
+  prof.startReport(2000);
+  report(&prof, &output);
+  text = (const char*) output.string();
+  check(NULL != strstr(text, "Profile: 500ms"), "The next report covers the time since the last");
+  check(NULL != strstr(text, "alpha               0 runs"), "A report starts the stats over");
+  check(NULL != strstr(text, "beta                1 runs  min 1.00us"), "...and the new ones are kept");
+
+  // Timers.
+  {
+    LuxProfTimer t(&prof, a);
+    uint32_t until = micros() + 200;
+    while ((int32_t) (micros() - until) < 0) {}
+  }
+  uint32_t t0 = LuxProfiler::ticks();
+  for (uint32_t i = 0; i < TEST_TIMER_RUNS; i++) {
+    LuxProfTimer t(&prof, b);
+  }
+  uint32_t cost = LuxProfiler::ticks() - t0;
+  output.clear();
+  prof.startReport(2500);
+  report(&prof, &output);
+  text = (const char*) output.string();
+  printf("%s", text);
+  check(NULL != strstr(text, "alpha               1 runs"), "A timer records when it goes out of scope");
+  printf("\tAn empty timer costs %u.%02uns here.\n", (cost * 10) / TEST_TIMER_RUNS, ((cost * 1000) / TEST_TIMER_RUNS) % 100);
+
+  if (failures) {
+    printf("FAIL: %u checks.\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,142 @@
+/*
+File:   scheduler_test.cpp
+Author: J. Ian Lindsay
+Date:   2026.10.19
+
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+
+LuxScheduler, off the board.
+
+    scheduler_test
+
+The clock is handed to serviceScheduledEvents() by the test, so nothing here
+  depends on how fast the host is. Checks that:
+  - A job runs on its deadlines, and a late run doesn't push the ones after it.
+  - A job that is behind is caught up at most max_catchup times in one pass, and
+    the deadlines past that are dropped and counted, not replayed.
+  - A job with a max_catchup of 1, as the sketch's frame job has, is never run
+    twice in a pass.
+  - A one-shot job runs once, and a job can disable itself from inside its run.
+  - Deadlines carry across micros() wrapping.
+
+Exits non-zero if any of them don't hold.
+*/
+
+#include "Arduino.h"
+#include "LuxScheduler.h"
+#include <StringBuilder.h>
+
+static uint32_t runs_a = 0;
+static uint32_t runs_b = 0;
+static uint32_t runs_c = 0;
+static int8_t   pid_c  = -1;
+static LuxScheduler* sched = NULL;
+static uint8_t  failures = 0;
+
+static void job_a() {   runs_a++;   }
+static void job_b() {   runs_b++;   }
+static void job_c() {
+  runs_c++;
+  sched->disableSchedule(pid_c);
+}
+
+
+static void check(bool ok, const char* what) {
+  printf("\t%-58s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok) failures++;
+}
+
+
+int main() {
+  LuxScheduler s;
+  sched = &s;
+
+  // Deadlines. The period is 1ms, and the job is enabled at 0.
+  int8_t pid_a = s.createSchedule("A", 1000, 3, false, job_a);
+  check(0 == pid_a, "First job is PID 0");
+  s.enableSchedule(pid_a, 0);
+  s.serviceScheduledEvents(999);
+  check(0 == runs_a, "Nothing runs before its deadline");
+  s.serviceScheduledEvents(1000);
+  check(1 == runs_a, "Runs on its deadline");
+  s.serviceScheduledEvents(1500);
+  check(1 == runs_a, "...and only once for it");
+  s.serviceScheduledEvents(2300);
+  check(2 == runs_a, "Runs late");
+  s.serviceScheduledEvents(2999);
+  check(2 == runs_a, "A late run doesn't bring the next one in...");
+  s.serviceScheduledEvents(3000);
+  check(3 == runs_a, "...or push it out");
+
+  // Falling behind. Deadlines at 4000 through 8000 are all due at 8500.
+  uint8_t n = s.serviceScheduledEvents(8500);
+  check((3 == n) && (6 == runs_a), "Caught up max_catchup times in one pass");
+  s.serviceScheduledEvents(8999);
+  check(6 == runs_a, "The rest are dropped, not replayed");
+  s.serviceScheduledEvents(9000);
+  check(7 == runs_a, "Picks up on its next deadline after now");
+  s.disableSchedule(pid_a);
+  s.serviceScheduledEvents(20000);
+  check(7 == runs_a, "A disabled job doesn't run");
+
+  // As the frame job is made. One run per pass, however far behind.
+  int8_t pid_b = s.createSchedule("B", 1000, 1, false, job_b);
+  s.enableSchedule(pid_b, 0);
+  n = s.serviceScheduledEvents(5500);
+  check((1 == n) && (1 == runs_b), "max_catchup of 1 runs once, 5 deadlines behind");
+  s.serviceScheduledEvents(5999);
+  check(1 == runs_b, "...and drops the other 4");
+  s.serviceScheduledEvents(6000);
+  check(2 == runs_b, "...and runs again on the next");
+
+  // One-shots, and a job that turns itself off.
+  pid_c = s.createSchedule("C", 500, 1, false, job_c);
+  s.enableSchedule(pid_c, 6000);
+  s.serviceScheduledEvents(6500);
+  s.serviceScheduledEvents(7000);
+  check((1 == runs_c) && !s.scheduleEnabled(pid_c), "A job can disable itself");
+  int8_t pid_d = s.createSchedule("D", 100, 4, true, job_c);
+  s.enableSchedule(pid_d, 7000);
+  s.serviceScheduledEvents(8000);
+  check((2 == runs_c) && !s.scheduleEnabled(pid_d), "A one-shot runs once, however late");
+
+  // Wrapping. Enabled 200us before micros() rolls over.
+  s.disableSchedule(pid_b);
+  runs_b = 0;
+  s.enableSchedule(pid_b, 0xFFFFFF38);
+  s.serviceScheduledEvents(0xFFFFFFF0);
+  check(0 == runs_b, "Not early across a wrap");
+  s.serviceScheduledEvents(800);
+  check(1 == runs_b, "Due across a wrap");
+  s.serviceScheduledEvents(1799);
+  check(1 == runs_b, "Next deadline is a period on, past the wrap...");
+  s.serviceScheduledEvents(1800);
+  check(2 == runs_b, "...and runs there");
+
+  check(-1 == s.createSchedule("X", 0, 1, false, job_a), "A period of 0 is refused");
+  for (uint8_t i = 4; i < LUX_SCHEDULER_MAX_JOBS; i++) s.createSchedule("Fill", 1000, 1, false, job_a);
+  check(-1 == s.createSchedule("X", 1000, 1, false, job_a), "No more jobs than LUX_SCHEDULER_MAX_JOBS");
+
+  StringBuilder output;
+  s.printDebug(&output);
+  printf("%s\n", (char*) output.string());
+  if (failures) {
+    printf("FAIL: %u checks.\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+#
+# Plays a sequence of 96x64 PNG frames to the panel over FrameStream (see
+#   FrameStream.h), from the host end of the Serial1 link.
+#
+# The first frame is sent whole, and after that only the 8x8 tiles that changed,
+#   as lxa_encode.py does it. The panel's acks are read back off the same link.
+#   Never more than its window of frames are in flight, and a frame it couldn't use
+#   is answered with a keyframe.
+#
+# With --port, frames go to that tty, which is put in raw mode at --baud. Without
+#   it, a pty is opened, and its name printed, for whatever wants to play the panel's
+#   end of the link. With -o, the packets are written to a file instead, with no
+#   flow control. host/frame_stream_test.cpp plays such a file back through
+#   FrameStream. host/traces/logo_wipe.fs was written this way.
+#
+# Usage:
+#   framestream_send.py [--port tty] [--baud n] [-o out] [--period ms] [--key-interval n]
+#                       [--loops n] frame0.png frame1.png ...
+#
+# Needs Pillow.
+
+import argparse
+import os
+import re
+import select
+import struct
+import sys
+import termios
+import time
+import tty
+
+import lxa_encode
+
+SYNC        = 0xF5
+TYPE_KEY    = 0x01
+TYPE_DELTA  = 0x02
+TYPE_PARAMS = 0x03
+MAX_PAYLOAD = 20000     # PROTOCOL_MTU, in FirmwareDefs.h.
+ACK_WANT_KEY = 0x01
+ACK_TIMEOUT  = 0.5      # Seconds to wait on a full window before sending anyway.
+
+ACK_LINE = re.compile(rb'ATCHVAR 8 (\d+),(\d+),(\d+)')
+
+BAUDS = {
+    9600: termios.B9600, 19200: termios.B19200, 38400: termios.B38400,
+    57600: termios.B57600, 115200: termios.B115200, 230400: termios.B230400,
+}
+
+
+def fletcher16(data):
+    a = 0
+    b = 0
+    for c in data:
+        a = (a + c) % 255
+        b = (b + a) % 255
+    return (b << 8) | a
+
+
+def packet(ptype, seq, payload):
+    if len(payload) > MAX_PAYLOAD:
+        sys.exit('A payload of %d bytes is over the %d the panel will take.' % (len(payload), MAX_PAYLOAD))
+    body = struct.pack('<BBH', ptype, seq & 0xFF, len(payload)) + bytes(payload)
+    return bytes([SYNC]) + body + struct.pack('<H', fletcher16(body))
+
+
+class Link:
+    """Writes packets out, and keeps track of what the panel has answered."""
+
+    def __init__(self, fd, flow):
+        self.fd = fd
+        self.flow = flow        # False for a file. Nothing will answer.
+        self.window = 2         # FRAME_STREAM_WINDOW, until the panel says otherwise.
+        self.in_flight = []
+        self.want_key = False
+        self.rx = b''
+        self.acks = 0
+        self.key_requests = 0
+
+    def write(self, data):
+        while data:
+            n = os.write(self.fd, data)
+            data = data[n:]
+
+    def poll(self, timeout):
+        if not self.flow:
+            return
+        ready, _, _ = select.select([self.fd], [], [], timeout)
+        if not ready:
+            return
+        try:
+            self.rx += os.read(self.fd, 4096)
+        except OSError:
+            return
+        lines = self.rx.split(b'\n')
+        self.rx = lines.pop()
+        for line in lines:
+            m = ACK_LINE.search(line)
+            if m is None:
+                continue
+            seq, flags, window = (int(g) for g in m.groups())
+            self.acks += 1
+            self.window = max(1, window)
+            if flags & ACK_WANT_KEY:
+                self.want_key = True
+                self.key_requests += 1
+            # Everything up to the acked frame has been dealt with, one way or another.
+            while self.in_flight and (((seq - self.in_flight[0]) & 0xFF) < 0x80):
+                self.in_flight.pop(0)
+
+    def wait_for_room(self):
+        if not self.flow:
+            return
+        deadline = time.monotonic() + ACK_TIMEOUT
+        while len(self.in_flight) >= self.window:
+            left = deadline - time.monotonic()
+            if left <= 0:
+                self.in_flight.pop(0)   # Lost, or never coming. Don't stall on it.
+                return
+            self.poll(left)
+
+
+def open_link(args):
+    if args.output:
+        return Link(os.open(args.output, os.O_WRONLY | os.O_CREAT | os.O_TRUNC, 0o644), False), None
+    if args.port:
+        fd = os.open(args.port, os.O_RDWR | os.O_NOCTTY)
+        if args.baud not in BAUDS:
+            sys.exit('No support for %d baud. Try one of %s.' % (args.baud, sorted(BAUDS)))
+        tty.setraw(fd)
+        attrs = termios.tcgetattr(fd)
+        attrs[4] = BAUDS[args.baud]
+        attrs[5] = BAUDS[args.baud]
+        termios.tcsetattr(fd, termios.TCSANOW, attrs)
+        return Link(fd, True), None
+    master, slave = os.openpty()
+    tty.setraw(slave)
+    print('Sending on %s' % os.ttyname(slave))
+    return Link(master, True), slave
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Stream PNG frames to the panel over FrameStream.')
+    parser.add_argument('frames', nargs='+')
+    parser.add_argument('--port', help='The tty the panel is on. Without it, a pty is opened.')
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('-o', '--output', help='Write the packets to a file instead.')
+    parser.add_argument('--period', type=int, default=50, help='Frame period in ms.')
+    parser.add_argument('--key-interval', type=int, default=0, help='Force a keyframe this often. 0 means only when asked.')
+    parser.add_argument('--loops', type=int, default=1, help='Times through the frames. 0 is forever.')
+    args = parser.parse_args()
+
+    frames = [lxa_encode.load_frame(p) for p in args.frames]
+    link, slave = open_link(args)
+
+    seq = 0
+    link.write(packet(TYPE_PARAMS, seq, struct.pack('<H', args.period)))
+    seq += 1
+
+    sent = 0
+    keys = 0
+    payload_bytes = 0
+    prior = None
+    due = time.monotonic()
+    loop = 0
+    try:
+        while (0 == args.loops) or (loop < args.loops):
+            for frame in frames:
+                link.wait_for_room()
+                key = (prior is None) or link.want_key or (args.key_interval and (0 == sent % args.key_interval))
+                payload = lxa_encode.encode_key(frame, None)
+                if not key:
+                    delta = lxa_encode.encode_delta(prior, frame, None)
+                    if len(delta) < len(payload):
+                        payload = delta
+                    else:
+                        key = True
+                if key:
+                    link.want_key = False
+                    keys += 1
+                link.write(packet(TYPE_KEY if key else TYPE_DELTA, seq, payload))
+                if link.flow:
+                    link.in_flight.append(seq & 0xFF)
+                seq += 1
+                sent += 1
+                payload_bytes += len(payload)
+                prior = frame
+
+                if link.flow:
+                    due += args.period / 1000.0
+                    while True:
+                        left = due - time.monotonic()
+                        if left <= 0:
+                            break
+                        link.poll(left)
+            loop += 1
+    except KeyboardInterrupt:
+        pass
+    finally:
+        os.close(link.fd)
+        if slave is not None:
+            os.close(slave)
+
+    print('%d frames (%d key), %d payload bytes. %d acks, %d keyframe requests.' % (
+        sent, keys, payload_bytes, link.acks, link.key_requests))
+
+
+if __name__ == '__main__':
+    main()
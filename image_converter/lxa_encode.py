@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+#
+# Builds an LXA animation container (see LuxAnimation.h) from a sequence of
+#   96x64 PNG frames.
+#
+# The first frame (and every --key-interval frames after that) is stored whole.
+#   Every other frame only carries the 8x8 tiles that differ from the frame before
+#   it, merged into rects along each tile row. Pixels are palette indices if the
+#   whole sequence fits in 256 colors, and RGB565 otherwise.
+#
+# Usage:
+#   lxa_encode.py [--period ms] [--key-interval n] [--c-array name] -o out frame0.png frame1.png ...
+#
+# With --c-array, the output is a C string literal in the same form as
+#   static_images.c, ready to be #included and handed to LuxAnimation::load().
+#
+# Needs Pillow.
+
+import argparse
+import struct
+import sys
+
+from PIL import Image
+
+WIDTH     = 96
+HEIGHT    = 64
+TILE      = 8
+TYPE_KEY  = 0x01
+TYPE_DELT = 0x02
+
+
+def rgb565(px):
+    r, g, b = px[0], px[1], px[2]
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def load_frame(path):
+    # Whatever is transparent is black on the panel, whatever color the file gives it.
+    img = Image.open(path).convert('RGBA')
+    img = Image.alpha_composite(Image.new('RGBA', img.size, (0, 0, 0, 255)), img).convert('RGB')
+    if img.size != (WIDTH, HEIGHT):
+        sys.exit('%s is %dx%d. Frames must be %dx%d.' % (path, img.size[0], img.size[1], WIDTH, HEIGHT))
+    data = img.tobytes()
+    return [rgb565(data[i * 3:(i * 3) + 3]) for i in range(WIDTH * HEIGHT)]
+
+
+def pack_pixel(color, palette):
+    if palette is not None:
+        return bytes([palette[color]])
+    return struct.pack('<H', color)
+
+
+def rle(pixels, palette):
+    """Runs in the form RectDecoder expects. Repeats win when they save bytes."""
+    out = bytearray()
+    min_repeat = 3 if palette is not None else 2
+    i = 0
+    while i < len(pixels):
+        j = i
+        while (j < len(pixels)) and (pixels[j] == pixels[i]) and (j - i < 128):
+            j += 1
+        if (j - i) >= min_repeat:
+            out.append(0x80 | (j - i - 1))
+            out += pack_pixel(pixels[i], palette)
+            i = j
+            continue
+        # Literal run, until the next worthwhile repeat.
+        k = i
+        while (k < len(pixels)) and (k - i < 128):
+            r = k
+            while (r < len(pixels)) and (pixels[r] == pixels[k]) and (r - k < min_repeat):
+                r += 1
+            if (r - k) >= min_repeat:
+                break
+            k += 1
+        if k == i:
+            k = i + 1
+        out.append(k - i - 1)
+        for p in pixels[i:k]:
+            out += pack_pixel(p, palette)
+        i = k
+    return out
+
+
+def rect(frame, col, row, w, h, palette):
+    pixels = [frame[(r * WIDTH) + c] for r in range(row, row + h) for c in range(col, col + w)]
+    return bytes([col, row, w, h]) + rle(pixels, palette)
+
+
+def encode_key(frame, palette):
+    return rect(frame, 0, 0, WIDTH, HEIGHT, palette)
+
+
+def encode_delta(prior, frame, palette):
+    out = bytearray()
+    for t_row in range(0, HEIGHT, TILE):
+        dirty = []
+        for t_col in range(0, WIDTH, TILE):
+            changed = False
+            for r in range(t_row, t_row + TILE):
+                base = r * WIDTH
+                if frame[base + t_col:base + t_col + TILE] != prior[base + t_col:base + t_col + TILE]:
+                    changed = True
+                    break
+            dirty.append(changed)
+        t = 0
+        while t < len(dirty):
+            if not dirty[t]:
+                t += 1
+                continue
+            start = t
+            while (t < len(dirty)) and dirty[t]:
+                t += 1
+            out += rect(frame, start * TILE, t_row, (t - start) * TILE, TILE, palette)
+    return out
+
+
+def c_literal(name, blob):
+    lines = ['/* LXA container: %d bytes. Built by image_converter/lxa_encode.py */' % len(blob)]
+    lines.append('static const unsigned int %s_len = %d;' % (name, len(blob)))
+    lines.append('static const char* %s = {' % name)
+    for i in range(0, len(blob), 24):
+        lines.append('  "' + ''.join('\\%03o' % b for b in blob[i:i + 24]) + '"')
+    lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Encode a PNG sequence as an LXA animation.')
+    parser.add_argument('frames', nargs='+')
+    parser.add_argument('-o', '--output', required=True)
+    parser.add_argument('--period', type=int, default=50, help='Frame period in ms.')
+    parser.add_argument('--key-interval', type=int, default=0, help='Force a keyframe this often. 0 means only the first.')
+    parser.add_argument('--c-array', metavar='NAME', help='Write a C literal instead of a binary file.')
+    args = parser.parse_args()
+
+    frames = [load_frame(p) for p in args.frames]
+
+    colors = sorted(set(c for f in frames for c in f))
+    palette = None
+    if len(colors) <= 256:
+        palette = dict((c, i) for i, c in enumerate(colors))
+
+    blob = bytearray(b'LXA1')
+    blob += struct.pack('<BBHHBB', WIDTH, HEIGHT, len(frames), args.period,
+                        0x01 if palette is not None else 0x00,
+                        (len(colors) & 0xFF) if palette is not None else 0)
+    if palette is not None:
+        for c in colors:
+            blob += struct.pack('<H', c)
+
+    raw_total = 0
+    for idx, frame in enumerate(frames):
+        key = (0 == idx) or (args.key_interval and (0 == idx % args.key_interval))
+        payload = encode_key(frame, palette)
+        if not key:
+            delta = encode_delta(frames[idx - 1], frame, palette)
+            if len(delta) < len(payload):
+                payload = delta
+            else:
+                key = True
+        if len(payload) > 0xFFFF:
+            sys.exit('Frame %d does not fit in a single LXA frame.' % idx)
+        blob += struct.pack('<BH', TYPE_KEY if key else TYPE_DELT, len(payload))
+        blob += payload
+        raw_total += WIDTH * HEIGHT * 2
+
+    if args.c_array:
+        with open(args.output, 'w') as f:
+            f.write(c_literal(args.c_array, blob))
+    else:
+        with open(args.output, 'wb') as f:
+            f.write(blob)
+
+    print('%d frames, %d bytes (raw would be %d). %s' % (
+        len(frames), len(blob), raw_total,
+        ('%d-color palette.' % len(colors)) if palette is not None else 'RGB565.'))
+
+
+if __name__ == '__main__':
+    main()
@@ -38,7 +38,9 @@ BSD license, all text above must be included in any redistribution.
 #include <StringBuilder.h>
 
 
-#define DMATGTADDR      (&LATE)                 // the DMA target address to write the pattern
+#if defined(ARDUINO)
+  #define DMATGTADDR      (&LATE)               // the DMA target address to write the pattern
+#endif
 
 #define    MAX_DEPTH_PER_CHANNEL  8
 #define    PANEL_WIDTH  192
@@ -51,7 +53,51 @@ uint8_t    depth_per_channel = MAX_DEPTH_PER_CHANNEL;
 const uint16_t plane_size = PANEL_HEIGHT * ((PANEL_WIDTH*2) + CONTROL_BYTES_PER_ROW);
 const uint16_t tail_length = (PANEL_WIDTH*2) + CONTROL_BYTES_PER_ROW;
 const uint16_t fb_size    = MAX_DEPTH_PER_CHANNEL * plane_size + tail_length;
-uint8_t        framebuffer[fb_size];
+uint8_t        framebuffer[fb_size] __attribute__ ((aligned (4)));
+
+/*
+* The scan order only changes which slot in a plane a row is sent in. The C-frame for
+*   each slot carries that row's address, so the DMA stream is the same length as before.
+*   scan_rows[plane][slot] is the row sent in a slot, and row_offset[plane][row] is where
+*   that row's D-frame starts in the render buffer. Everything that writes pixels goes
+*   through row_offset, so it follows the scan order without knowing about it.
+*/
+uint8_t        scan_rows[MAX_DEPTH_PER_CHANNEL][PANEL_HEIGHT];
+uint32_t       row_offset[MAX_DEPTH_PER_CHANNEL][PANEL_HEIGHT];
+
+
+/*
+* Rows sent far apart in time blend better than neighbors swept top-to-bottom, which
+*   the eye (and any camera) sees as a rolling band at low refresh rates.
+*/
+static void build_scan_tables(uint8_t order) {
+  uint8_t base[PANEL_HEIGHT];
+  for (int i = 0; i < PANEL_HEIGHT; i++) {
+    switch (order & 0x7F) {
+      case SCAN_ORDER_INTERLEAVED:
+        base[i] = (i < (PANEL_HEIGHT/2)) ? (i * 2) : (((i - (PANEL_HEIGHT/2)) * 2) + 1);
+        break;
+      case SCAN_ORDER_BIT_REVERSED:
+        // PANEL_HEIGHT is 16, so reverse 4 bits.
+        base[i] = ((i & 0x01) << 3) | ((i & 0x02) << 1) | ((i & 0x04) >> 1) | ((i & 0x08) >> 3);
+        break;
+      case SCAN_ORDER_LINEAR:
+      default:
+        base[i] = i;
+        break;
+    }
+  }
+
+  for (int plane = 0; plane < MAX_DEPTH_PER_CHANNEL; plane++) {
+    // Staggering the planes means that no row is always first (or last) out of the gate.
+    int stagger = (order & SCAN_ORDER_STAGGER_PLANES) ? ((plane * PANEL_HEIGHT) / MAX_DEPTH_PER_CHANNEL) : 0;
+    for (int slot = 0; slot < PANEL_HEIGHT; slot++) {
+      uint8_t row = base[(slot + stagger) % PANEL_HEIGHT];
+      scan_rows[plane][slot] = row;
+      row_offset[plane][row] = (plane * plane_size) + (slot * ((PANEL_WIDTH*2) + CONTROL_BYTES_PER_ROW));
+    }
+  }
+}
 
 
 
@@ -63,6 +109,7 @@ uint8_t        framebuffer[fb_size];
   *
   * ---J. Ian Lindsay   Mon Mar 16 06:46:38 MST 2015
   */
+#if defined(ARDUINO)
   static volatile uint32_t __irq_suspend = 0;
   
   void cli() {
@@ -72,6 +119,11 @@ uint8_t        framebuffer[fb_size];
   void sei() {
     restoreInterrupts(__irq_suspend);
   }
+#else
+  // Off the board, there is no interrupt to hold off.
+  void cli() {}
+  void sei() {}
+#endif
 
 
 // Constructor for 32x32 or 32x64 panel:
@@ -83,6 +135,7 @@ RGBmatrixPanel::RGBmatrixPanel() :
   // If not double-buffered, both buffers then point to the same address:
   //matrixbuff[1] = (dbuf) ? &matrixbuff[0][buffsize] : matrixbuff[0];
 
+#if defined(ARDUINO)
     // Disable Timers and DMA
     T4CON               = 0;
     DCH3CON             = 0;
@@ -122,9 +175,14 @@ RGBmatrixPanel::RGBmatrixPanel() :
     DCH3DSA             = KVA_2_PA(DMATGTADDR);     // destination address is RE0 - RE7
     DCH3DSIZ            = 1;           // CBYTESREQUIRED bytes at the destination
     DCH3CSIZ            = fb_size;           // only transfer CBYTESREQUIRED bytes per event
+#endif
 
   swapflag  = false;
   backindex = 0;     // Array index of back buffer
+
+  _ctl_style  = 0;
+  _scan_order = SCAN_ORDER_LINEAR;
+  build_scan_tables(_scan_order);
 }
 
 void RGBmatrixPanel::begin(void) {
@@ -134,7 +192,7 @@ void RGBmatrixPanel::begin(void) {
   _fInit = true;
   cli();
   sei();
-  DCH3CONbits.CHEN   = 1;
+  RunDMA();
 }
 
 
@@ -169,19 +227,23 @@ void RGBmatrixPanel::init_fb(int ctl_style) {
   //   D-Frame = "Data frame".    Data desined for the panel's data pins (r0, r1, g0, g1, b0, b1)
   //   TAIL    = The tail frame is a row's worth of meaningless data that we write for timing reasons.
   //
-  // /---------|-----------|---------|-----------|---------|-----------|---------|-----------|------\
+  // +---------|-----------|---------|-----------|---------|-----------|---------|-----------|------+
   // | C-Frame | D-Frame 0 | C-Frame | D-Frame 1 | C-Frame | D-Frame 2 | C-Frame | D-Frame 3 | TAIL |
-  // \---------|-----------|---------|-----------|---------|-----------|---------|-----------|------/
+  // +---------|-----------|---------|-----------|---------|-----------|---------|-----------|------+
   //
   // 
   //
+  // The row addresses in the C-frames are taken from the scan order. See setScanOrder().
+  //
+  _ctl_style = ctl_style;
   int ren_buf_idx = 0;  // This is our accumulated index inside of the render buffer.
   for (int plane = 0; plane < depth_per_channel; plane++) {
     
     
     
 if (ctl_style == 0) {
-    for (int _cur_row = 0; _cur_row < PANEL_HEIGHT; _cur_row++) {
+    for (int _slot = 0; _slot < PANEL_HEIGHT; _slot++) {
+      int _cur_row = scan_rows[plane][_slot];
       for (int k = 0; k < PANEL_WIDTH; k++) {
         // Zero-out the D-Frame and install the panel clock band...
         framebuffer[ren_buf_idx++] = 0;
@@ -201,7 +263,8 @@ if (ctl_style == 0) {
 
 
 else if (ctl_style == 1) {
-    for (int _cur_row = 0; _cur_row < PANEL_HEIGHT; _cur_row++) {
+    for (int _slot = 0; _slot < PANEL_HEIGHT; _slot++) {
+      int _cur_row = scan_rows[plane][_slot];
       for (int k = 0; k < PANEL_WIDTH; k++) {
         // Zero-out the D-Frame and install the panel clock band...
         framebuffer[ren_buf_idx++] = 0;
@@ -221,7 +284,8 @@ else if (ctl_style == 1) {
 
 
 else if (ctl_style == 2) {
-    for (int _cur_row = 0; _cur_row < PANEL_HEIGHT; _cur_row++) {
+    for (int _slot = 0; _slot < PANEL_HEIGHT; _slot++) {
+      int _cur_row = scan_rows[plane][_slot];
       for (int k = 0; k < PANEL_WIDTH; k++) {
         // Zero-out the D-Frame and install the panel clock band...
         framebuffer[ren_buf_idx++] = 0;
@@ -240,7 +304,8 @@ else if (ctl_style == 2) {
 
 
 else {
-    for (int _cur_row = 0; _cur_row < PANEL_HEIGHT; _cur_row++) {
+    for (int _slot = 0; _slot < PANEL_HEIGHT; _slot++) {
+      int _cur_row = scan_rows[plane][_slot];
       for (int k = 0; k < PANEL_WIDTH; k++) {
         // Zero-out the D-Frame and install the panel clock band...
         framebuffer[ren_buf_idx++] = 0;
@@ -274,6 +339,19 @@ else {
 
 
 
+/*
+* Changes the order in which rows are scanned out. This rebuilds the render buffer,
+*   so whatever was on the panel is lost, and should be redrawn by the caller.
+*/
+void RGBmatrixPanel::setScanOrder(uint8_t order) {
+  haltDMA();
+  while (!DMADone()) {}
+  _scan_order = order;
+  build_scan_tables(order);
+  init_fb(_ctl_style);
+}
+
+
 
 // Original RGBmatrixPanel library used 3/3/3 color.  Later version used
 // 4/4/4.  Then Adafruit_GFX (core library used across all Adafruit
@@ -364,22 +442,19 @@ uint16_t RGBmatrixPanel::ColorHSV(
 }
 
 
-void RGBmatrixPanel::drawPixel(int16_t x, int16_t y, uint16_t color) {
-  if ((x > 63) || (y > 95)) return;
+/*
+* Translates a logical (x, y) into the panel row it is scanned on, the byte offset of
+*   its column within that row's D-frame, and the shift of the 3-bit (r,g,b) field
+*   within that byte. Add row_offset[plane][row] to find the byte in a given plane.
+* Returns -1 if the point is off the panel.
+*/
+int32_t RGBmatrixPanel::planarOffset(int16_t x, int16_t y, uint8_t* row, uint8_t* shift) {
+  if ((x < 0) || (y < 0) || (x > 63) || (y > 95)) return -1;
 
-  // Experimenting with color depth...
-  uint8_t r = (color >> 13) & 0x07;   // RRRRrggggggbbbbb
-  uint8_t g = (color >> 8)  & 0x07;   // rrrrrGGGGggbbbbb
-  uint8_t b = (color >> 2)  & 0x07;   // rrrrrggggggBBBBb
-  //uint8_t r = (color >> 12) & 0x0F;   // RRRRrggggggbbbbb
-  //uint8_t g = (color >> 7)  & 0x0F;   // rrrrrGGGGggbbbbb
-  //uint8_t b = (color >> 1)  & 0x0F;   // rrrrrggggggBBBBb
-  
   int orig_y = y;
 
   // The panel is laid out in a 2x3 arrangement (64x96) So first, translate 
   // the coordinates into the 192x32 display that is reflected by the panel electronics.
-  uint8_t starting_x = 192;
   y = y % 32;
   if (orig_y >= 64) {
     x += 128;
@@ -387,8 +462,6 @@ void RGBmatrixPanel::drawPixel(int16_t x, int16_t y, uint16_t color) {
   else if (orig_y >= 32) {
     x += 64;
   }
-  else {
-  }
 
   /* Because our panel layout is not a single unit, we need to correct for
      the offsets to make this function logical to the caller. */
@@ -401,27 +474,160 @@ void RGBmatrixPanel::drawPixel(int16_t x, int16_t y, uint16_t color) {
   }
 
   // Then, condense the y-coordinate, because we packed two pixels into a single byte.
-  int shift_offset  = (y<16) ? 0 : 3;
-  y = (y<16) ? y : y-16;
-  
-  // Find the byte offset within each plane.
-  uint16_t planar_offset = (y * (CONTROL_BYTES_PER_ROW + (PANEL_WIDTH * 2))) + (x*2);
+  *shift = (y<16) ? 0 : 3;
+  *row   = (y<16) ? y : y-16;
+
+  // Find the byte offset within the row. Where the row is depends on the scan order.
+  return (x*2);
+}
+
+
+/*
+* Slices a color into its 3-bit (r,g,b) pattern for each plane. A channel is lit in
+*   as many planes as its value, so plane p carries the channel if (value > p).
+*/
+uint32_t RGBmatrixPanel::planePattern(uint16_t color) {
+  // Experimenting with color depth...
+  uint8_t r = (color >> 13) & 0x07;   // RRRRrggggggbbbbb
+  uint8_t g = (color >> 8)  & 0x07;   // rrrrrGGGGggbbbbb
+  uint8_t b = (color >> 2)  & 0x07;   // rrrrrggggggBBBBb
+  //uint8_t r = (color >> 12) & 0x0F;   // RRRRrggggggbbbbb
+  //uint8_t g = (color >> 7)  & 0x0F;   // rrrrrGGGGggbbbbb
+  //uint8_t b = (color >> 1)  & 0x0F;   // rrrrrggggggBBBBb
+
+  uint32_t pattern = 0;
+  for (int plane = 0; plane < MAX_DEPTH_PER_CHANNEL; plane++) {
+    uint32_t nu_bits = 0;
+    if (r > plane) nu_bits |= 0x01;
+    if (g > plane) nu_bits |= 0x02;
+    if (b > plane) nu_bits |= 0x04;
+    pattern |= (nu_bits << (plane * 3));
+  }
+  return pattern;
+}
+
+
+void RGBmatrixPanel::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  uint8_t row = 0;
+  uint8_t shift_offset = 0;
+  int32_t col_offset = planarOffset(x, y, &row, &shift_offset);
+  if (col_offset < 0) return;
+
+  uint32_t pattern = planePattern(color);
 
   uint8_t temp_byte = 0;
   uint8_t nu_byte   = 0;
   for (int plane = 0; plane < depth_per_channel; plane++) {
-    temp_byte = *(framebuffer + (plane * plane_size)+planar_offset) & ~(0x07 << shift_offset);
-    nu_byte   = 0;
-    if (r>0) nu_byte = nu_byte + (1 << (shift_offset+0));
-    if (g>0) nu_byte = nu_byte + (1 << (shift_offset+1));
-    if (b>0) nu_byte = nu_byte + (1 << (shift_offset+2));
-
-    *(framebuffer + (plane * plane_size)+planar_offset)   = nu_byte | temp_byte;
-    *(framebuffer + (plane * plane_size)+planar_offset+1) = nu_byte | temp_byte | 0x40;
-
-    if (r > 0) r--;
-    if (g > 0) g--;
-    if (b > 0) b--;
+    uint8_t* planar = framebuffer + row_offset[plane][row] + col_offset;
+    temp_byte = *(planar) & ~(0x07 << shift_offset);
+    nu_byte   = ((pattern >> (plane * 3)) & 0x07) << shift_offset;
+
+    *(planar)   = nu_byte | temp_byte;
+    *(planar+1) = nu_byte | temp_byte | 0x40;
+  }
+}
+
+
+/*
+* Converts an RGB565 image (in rows along the x-axis) into a sprite. This is the
+*   expensive part, and is meant to be done once. Pixels matching the transparent
+*   color are left uncovered.
+* Returns false if we couldn't get the memory.
+*/
+bool RGBmatrixPanel::makeSprite(RGBSprite* sprite, const uint16_t* pixels, uint8_t w, uint8_t h, uint16_t transparent) {
+  sprite->w  = w;
+  sprite->h  = h;
+  sprite->px = (uint32_t*) malloc(w * h * sizeof(uint32_t));
+  if (NULL == sprite->px) return false;
+
+  for (int i = 0; i < (w * h); i++) {
+    uint16_t color = *(pixels + i);
+    *(sprite->px + i) = (color == transparent) ? 0 : (planePattern(color) | SPRITE_COVERED);
+  }
+  return true;
+}
+
+
+void RGBmatrixPanel::freeSprite(RGBSprite* sprite) {
+  if (NULL != sprite->px) free(sprite->px);
+  sprite->px = NULL;
+  sprite->w  = 0;
+  sprite->h  = 0;
+}
+
+
+/*
+* Within one logical row, consecutive x land in consecutive columns of the render
+*   buffer (2 bytes apart), so each clipped sprite row is a single span per plane.
+*   We resolve the row and column once per sprite row and then walk each plane with
+*   masked writes.
+*/
+void RGBmatrixPanel::blitSprite(const RGBSprite* sprite, int16_t x, int16_t y, bool erase) {
+  if (NULL == sprite->px) return;
+
+  int16_t sx0 = (x < 0) ? -x : 0;
+  int16_t sx1 = ((x + sprite->w) > 64) ? (64 - x) : sprite->w;
+  if (sx0 >= sx1) return;
+
+  for (int16_t sy = 0; sy < sprite->h; sy++) {
+    uint8_t row   = 0;
+    uint8_t shift = 0;
+    int32_t offset = planarOffset(x + sx0, y + sy, &row, &shift);
+    if (offset < 0) continue;
+
+    const uint32_t* src  = sprite->px + (sy * sprite->w);
+    const uint8_t   mask = ~(0x07 << shift);
+
+    for (int plane = 0; plane < depth_per_channel; plane++) {
+      uint8_t* span = framebuffer + row_offset[plane][row] + offset;
+      uint8_t  p_shift = plane * 3;
+      for (int16_t sx = sx0; sx < sx1; sx++) {
+        uint32_t word = *(src + sx);
+        if (word & SPRITE_COVERED) {
+          uint8_t nu_byte = (*span & mask);
+          if (!erase) nu_byte |= ((word >> p_shift) & 0x07) << shift;
+          *(span)   = nu_byte;
+          *(span+1) = nu_byte | 0x40;
+        }
+        span += 2;
+      }
+    }
+  }
+}
+
+
+void RGBmatrixPanel::drawSprite(const RGBSprite* sprite, int16_t x, int16_t y) {
+  blitSprite(sprite, x, y, false);
+}
+
+
+void RGBmatrixPanel::eraseSprite(const RGBSprite* sprite, int16_t x, int16_t y) {
+  blitSprite(sprite, x, y, true);
+}
+
+
+/*
+* Logical rows y and y+16 (within the same 32-row band) share every byte of their
+*   D-frame. Given all 64 patterns of both, each byte can be written whole, with no
+*   read-modify-write. This is for effects that repaint the entire panel anyway.
+* y must be in the upper half of its band. Patterns are as in a sprite, but
+*   SPRITE_COVERED is ignored.
+*/
+void RGBmatrixPanel::drawPatternRows(int16_t y, const uint32_t* upper, const uint32_t* lower) {
+  uint8_t row   = 0;
+  uint8_t shift = 0;
+  int32_t offset = planarOffset(0, y, &row, &shift);
+  if ((offset < 0) || (0 != shift)) return;
+
+  for (int plane = 0; plane < depth_per_channel; plane++) {
+    uint8_t* span = framebuffer + row_offset[plane][row] + offset;
+    uint8_t  p_shift = plane * 3;
+    for (int x = 0; x < 64; x++) {
+      uint8_t nu_byte = ((*(upper + x) >> p_shift) & 0x07) | (((*(lower + x) >> p_shift) & 0x07) << 3);
+      *(span)   = nu_byte;
+      *(span+1) = nu_byte | 0x40;
+      span += 2;
+    }
   }
 }
 
@@ -467,6 +673,21 @@ void RGBmatrixPanel::dumpMatrix(void) {
   Serial.println((char*) temp.string());
 }
 
+// FNV-1a over the render buffer, a word at a time. The size is the buffer's own, not
+//   the fb_size member, which nothing ever sets.
+uint32_t RGBmatrixPanel::checksum(void) {
+  uint32_t h = 2166136261UL;
+  const uint32_t* w = (const uint32_t*) framebuffer;
+  uint16_t i;
+  for (i = 0; i < (::fb_size >> 2); i++) {
+    h = (h ^ w[i]) * 16777619UL;
+  }
+  for (i = i << 2; i < ::fb_size; i++) {
+    h = (h ^ framebuffer[i]) * 16777619UL;
+  }
+  return h;
+}
+
 // -------------------- Interrupt handler stuff --------------------
 
 
@@ -1,9 +1,12 @@
-#include "pins_arduino.h"
-
-#if ARDUINO >= 100
-  #include "Arduino.h"
+#if defined(ARDUINO)
+  #include "pins_arduino.h"
+  #if ARDUINO >= 100
+    #include "Arduino.h"
+  #else
+    #include "WProgram.h"
+  #endif
 #else
-  #include "WProgram.h"
+  #include <Arduino.h>    // Off the board. Whatever stands in for the core.
 #endif
   
 #if defined(MPIDE)
@@ -25,6 +28,28 @@
 
 #define KVA_2_PA(v) (((uint32_t) (v)) & 0x1fffffff)
 
+#define SPRITE_COVERED  0x80000000              // Set in a sprite pixel that isn't transparent.
+
+/* Order in which the rows of each plane are scanned out. See setScanOrder(). */
+#define SCAN_ORDER_LINEAR          0x00         // 0, 1, 2, 3... The original behavior.
+#define SCAN_ORDER_INTERLEAVED     0x01         // Evens, then odds.
+#define SCAN_ORDER_BIT_REVERSED    0x02         // 0, 8, 4, 12, 2, 10...
+#define SCAN_ORDER_STAGGER_PLANES  0x80         // OR'd with the above. Each plane starts further into the order.
+
+
+/*
+* A sprite that has already been sliced into the render buffer's bit planes.
+* Each pixel is one word. Bits 0-23 hold the 3-bit (b,g,r) pattern for each of the
+*   8 planes, in plane order. SPRITE_COVERED marks pixels that are not transparent.
+* Pixels are stored in rows of w, where a row runs along the x-axis of drawPixel().
+*   That is the direction in which the render buffer is contiguous.
+*/
+typedef struct rgb_sprite_t {
+  uint8_t   w;
+  uint8_t   h;
+  uint32_t* px;
+} RGBSprite;
+
     
 class RGBmatrixPanel : public Adafruit_GFX {
   public:
@@ -32,9 +57,16 @@ class RGBmatrixPanel : public Adafruit_GFX {
 
     void begin();
     void drawPixel(int16_t x, int16_t y, uint16_t c);
+
+    bool makeSprite(RGBSprite*, const uint16_t* pixels, uint8_t w, uint8_t h, uint16_t transparent);
+    void freeSprite(RGBSprite*);
+    void drawSprite(const RGBSprite*, int16_t x, int16_t y);
+    void eraseSprite(const RGBSprite*, int16_t x, int16_t y);   // Blacks out the covered pixels.
+    void drawPatternRows(int16_t y, const uint32_t* upper, const uint32_t* lower);   // Full-width rows y and y+16.
     void updateDisplay();
     bool takePatternBuffer();
     void releasePatternBuffer();
+#if defined(ARDUINO)
     inline void     RunDMA() {
       DCH3CONbits.CHEN = 1;
     }
@@ -44,12 +76,21 @@ class RGBmatrixPanel : public Adafruit_GFX {
     inline void haltDMA() {
       DCH3CONbits.CHEN = 0;
     }
+#else
+    // Off the board, nothing scans the buffer out. It is only drawn into.
+    inline void     RunDMA() {}
+    inline uint32_t DMADone() {   return 1;   }
+    inline void     haltDMA() {}
+#endif
   
     void init_fb(int ctl_style);
+    void setScanOrder(uint8_t order);
+    inline uint8_t scanOrder() {   return _scan_order;   };
 
 
     void swapBuffers(boolean);
     void dumpMatrix(void);
+    uint32_t checksum(void);   // Of the whole render buffer. For telling two runs apart.
     uint8_t* backBuffer(void);
   
     uint16_t Color333(uint8_t r, uint8_t g, uint8_t b);
@@ -59,6 +100,13 @@ class RGBmatrixPanel : public Adafruit_GFX {
     uint16_t ColorHSV(long hue, uint8_t sat, uint8_t val, boolean gflag);
 
   private:
+    int32_t  planarOffset(int16_t x, int16_t y, uint8_t* row, uint8_t* shift);
+    uint32_t planePattern(uint16_t color);
+    void     blitSprite(const RGBSprite*, int16_t x, int16_t y, bool erase);
+
+    uint8_t         _scan_order;
+    int             _ctl_style;
+
     bool            _fInit;
     bool            _fInvert;
     bool            _fHavePatternBuffer;
@@ -0,0 +1,571 @@
+/*****************************************************************************************
+*** Animations, for LuxAnimation to play out of flash.
+*****************************************************************************************/
+
+/*
+* logo_wipe: the Digilent, Manuvr and Microchip logos, each held for four frames and
+*   then wiped to the next from the left, one tile column a frame. 45 frames, 80ms
+*   apiece. The frames were cut from the 96x64 PNGs in image_converter/, and then:
+*     lxa_encode.py --period 80 --c-array logo_wipe -o static_animations.c f*.png
+*/
+/* LXA container: 13357 bytes. Built by image_converter/lxa_encode.py */
+static const unsigned int logo_wipe_len = 13357;
+static const char* logo_wipe = {
+  "\114\130\101\061\140\100\055\000\120\000\000\000\001\237\011\000\000\140\100\377\000\000\377\000"
+  "\000\377\000\000\377\000\000\377\000\000\377\000\000\377\000\000\377\000\000\377\000\000\377\000"
+  "\000\377\000\000\377\000\000\377\000\000\377\000\000\377\000\000\354\000\000\002\040\000\202\020"
+  "\040\010\333\000\000\201\353\132\001\327\275\317\163\332\000\000\005\044\041\070\306\166\255\121"
+  "\204\370\275\347\071\330\000\000\006\040\000\317\173\273\326\232\316\061\204\226\255\165\255\316"
+  "\000\000\001\100\000\305\002\205\106\003\012\146\003\244\002\004\041\172\316\273\326\272\326\165"
+  "\255\262\224\267\265\054\143\303\001\206\106\003\000\105\003\203\045\003\000\105\003\204\106\003"
+  "\201\045\003\204\106\003\004\105\003\146\003\207\013\146\003\105\003\203\106\003\000\105\003\201"
+  "\045\003\201\106\003\000\105\003\201\045\003\204\106\003\204\045\003\000\105\003\201\106\003\002"
+  "\105\003\045\003\105\003\203\106\003\201\045\003\201\106\003\205\045\003\201\105\003\004\106\003"
+  "\245\002\100\000\241\000\146\003\206\045\003\012\100\000\363\234\374\336\364\234\367\275\232\326"
+  "\357\173\327\265\065\245\104\041\345\002\204\045\003\010\004\003\060\155\364\225\324\215\323\215"
+  "\222\175\316\134\106\013\005\003\201\045\003\004\106\003\025\236\365\225\053\064\005\003\201\045"
+  "\003\007\046\003\060\145\066\246\167\266\126\246\121\165\146\013\005\003\201\045\003\010\113\074"
+  "\365\225\025\236\045\003\005\003\114\074\324\215\263\205\311\043\202\045\003\000\004\003\203\324"
+  "\215\007\364\225\020\145\106\003\147\013\222\175\364\225\060\155\344\002\201\045\003\005\352\053"
+  "\365\225\364\225\106\013\311\043\263\205\203\324\215\007\364\225\114\074\012\054\053\064\206\003"
+  "\201\000\241\000\106\003\205\045\003\014\202\001\151\112\333\336\171\316\055\143\353\132\034\337"
+  "\327\265\357\173\367\275\055\153\142\001\106\003\203\045\003\001\344\002\331\306\203\377\377\005"
+  "\336\367\134\337\352\053\005\003\045\003\106\003\201\377\377\005\357\134\005\003\045\003\046\003"
+  "\372\316\337\377\202\377\377\002\337\377\134\337\250\033\201\005\003\000\060\155\201\377\377\005"
+  "\045\003\005\003\061\155\377\377\276\367\114\074\202\045\003\000\304\002\204\377\377\011\270\276"
+  "\106\003\250\033\134\347\377\377\276\367\154\104\005\003\045\003\215\114\201\377\377\002\147\013"
+  "\114\074\276\367\204\377\377\006\121\165\020\145\316\124\250\023\201\000\241\000\106\003\204\045"
+  "\003\015\305\002\302\010\030\306\272\326\222\224\360\173\317\173\222\224\374\336\256\163\166\255"
+  "\327\265\243\030\204\002\203\045\003\013\344\002\331\306\377\377\175\347\167\256\073\327\337\377"
+  "\377\377\235\357\147\023\045\003\106\003\201\377\377\003\357\134\005\003\004\003\270\276\201\377"
+  "\377\010\230\266\162\175\230\266\337\377\276\367\323\215\004\003\005\003\060\145\201\377\377\005"
+  "\045\003\005\003\060\155\337\377\236\357\114\074\202\045\003\011\304\002\337\377\377\377\032\317"
+  "\066\236\066\246\121\165\106\003\250\033\134\337\201\377\377\003\372\306\207\023\045\003\215\114"
+  "\201\377\377\013\147\023\012\064\372\306\073\327\337\377\377\377\175\347\073\327\017\145\106\013"
+  "\250\033\105\003\201\241\000\000\106\003\204\045\003\015\243\001\055\153\232\326\131\306\156\153"
+  "\121\214\014\143\145\051\171\316\232\326\216\163\327\275\161\214\200\000\203\045\003\013\344\002"
+  "\331\306\377\377\230\266\005\003\344\002\162\175\337\367\337\377\161\165\005\003\106\003\201\377"
+  "\377\013\357\134\004\003\113\074\276\367\377\377\025\236\005\003\304\002\344\002\316\124\250\033"
+  "\243\002\201\005\003\000\060\145\201\377\377\005\045\003\005\003\060\155\337\377\236\357\114\074"
+  "\202\045\003\003\304\002\337\377\377\377\222\175\201\045\003\003\005\003\045\003\250\033\134\337"
+  "\202\377\377\002\263\205\005\003\215\114\201\377\377\010\207\023\005\003\344\002\046\003\276\357"
+  "\377\377\060\155\243\002\005\003\201\045\003\000\106\003\201\241\000\000\106\003\203\045\003\017"
+  "\345\002\303\030\367\275\333\336\060\204\317\173\061\204\141\010\001\001\222\224\272\326\064\245"
+  "\263\224\327\275\151\112\302\001\202\045\003\013\344\002\331\306\377\377\230\266\106\003\045\003"
+  "\250\033\175\347\377\377\066\246\045\003\106\003\201\377\377\010\357\134\344\002\060\155\337\377"
+  "\276\367\215\114\344\002\357\134\365\225\201\324\215\003\364\225\053\064\005\003\060\145\201\377"
+  "\377\005\045\003\005\003\060\155\337\377\236\357\114\074\202\045\003\013\304\002\337\377\377\377"
+  "\134\347\331\306\372\316\060\155\046\003\250\033\134\337\377\377\230\266\201\377\377\001\215\114"
+  "\154\104\201\377\377\000\207\023\201\045\003\004\207\023\276\357\377\377\121\165\004\003\202\045"
+  "\003\000\106\003\201\241\000\000\106\003\202\045\003\021\106\003\301\000\216\163\373\336\030\306"
+  "\253\122\222\224\247\071\202\001\204\002\044\031\272\326\070\306\121\214\226\265\024\235\043\021"
+  "\345\002\201\045\003\013\344\002\331\306\377\377\230\266\106\003\045\003\207\023\175\347\377\377"
+  "\126\246\046\003\106\003\201\377\377\007\357\134\344\002\121\165\337\377\276\367\053\064\344\002"
+  "\065\236\201\377\377\201\337\377\002\357\134\005\003\060\145\201\377\377\005\045\003\005\003\060"
+  "\155\337\377\236\357\114\074\202\045\003\001\304\002\337\377\203\377\377\011\323\215\046\003\250"
+  "\033\134\337\377\377\162\175\263\205\377\377\276\367\357\144\201\377\377\000\207\023\201\045\003"
+  "\004\207\023\276\357\377\377\121\165\004\003\202\045\003\000\106\003\201\241\000\000\106\003\202"
+  "\045\003\021\043\002\343\030\373\336\273\326\354\132\162\214\156\153\241\010\105\003\106\003\300"
+  "\000\216\163\034\337\222\224\024\245\267\265\253\132\343\001\201\045\003\013\344\002\331\306\377"
+  "\377\230\266\106\003\005\003\113\074\236\357\377\377\364\225\005\003\106\003\201\377\377\002\357"
+  "\134\004\003\316\124\201\336\367\011\316\124\344\002\357\134\025\236\167\266\337\377\276\367\215"
+  "\114\005\003\060\145\201\377\377\005\045\003\005\003\060\155\337\377\235\357\113\074\201\005\003"
+  "\004\045\003\344\002\337\377\377\377\126\246\201\256\124\011\352\053\045\003\250\033\134\337\377"
+  "\377\161\165\147\023\033\327\377\377\276\367\201\377\377\000\207\023\201\045\003\004\207\023\276"
+  "\357\377\377\121\165\004\003\202\045\003\000\106\003\201\241\000\000\106\003\201\045\003\010\005"
+  "\003\200\000\125\245\333\336\323\234\257\163\061\204\246\061\044\002\201\045\003\025\345\002\101"
+  "\000\327\265\273\326\115\153\327\275\064\245\303\020\345\002\045\003\344\002\331\306\377\377\372"
+  "\306\114\074\316\124\331\306\377\377\337\377\215\104\005\003\106\003\201\377\377\016\357\134\005"
+  "\003\207\023\175\347\377\377\271\276\250\033\243\002\005\003\364\225\337\377\174\347\250\033\005"
+  "\003\060\145\201\377\377\014\045\003\005\003\060\155\337\377\276\367\161\165\215\114\215\104\250"
+  "\033\304\002\337\377\377\377\365\225\201\012\064\007\311\043\045\003\250\033\134\337\377\377\161"
+  "\165\304\002\154\104\203\377\377\000\207\023\201\045\003\004\207\023\276\357\377\377\121\165\004"
+  "\003\202\045\003\000\106\003\201\241\000\000\106\003\201\045\003\010\343\001\252\122\232\326\070"
+  "\306\257\163\061\204\156\153\341\000\005\003\201\045\003\017\105\003\343\001\350\101\333\336\327"
+  "\275\256\163\030\276\155\153\341\000\146\003\344\002\331\306\377\377\337\367\235\357\276\367\201"
+  "\377\377\003\324\215\005\003\045\003\106\003\201\377\377\000\357\134\201\005\003\000\256\124\201"
+  "\377\377\005\174\347\033\317\134\337\337\377\377\377\162\165\201\005\003\000\060\145\201\377\377"
+  "\027\045\003\005\003\060\155\337\377\377\377\276\367\276\357\235\357\357\134\303\002\337\377\377"
+  "\377\276\367\235\357\236\357\126\246\106\003\250\033\134\337\377\377\161\165\344\002\005\003\061"
+  "\155\202\377\377\000\207\023\201\045\003\004\207\023\276\357\377\377\121\165\004\003\202\045\003"
+  "\000\106\003\201\241\000\012\106\003\045\003\005\003\003\021\165\255\272\326\024\245\156\153\162"
+  "\214\003\031\043\002\204\045\003\012\002\011\363\234\333\326\020\174\125\255\370\275\004\041\104"
+  "\002\344\002\270\276\337\377\202\276\367\002\134\337\317\134\005\003\201\045\003\000\106\003\201"
+  "\377\377\005\316\124\005\003\045\003\005\003\215\114\235\357\202\337\367\005\336\367\121\165\344"
+  "\002\045\003\005\003\020\145\201\377\377\002\045\003\005\003\060\155\203\276\367\002\276\357\357"
+  "\134\303\002\203\276\367\007\337\367\167\256\106\003\210\033\073\327\377\377\121\165\344\002\201"
+  "\045\003\000\227\266\201\337\377\000\207\023\201\045\003\004\147\023\235\347\377\377\121\165\004"
+  "\003\202\045\003\014\106\003\241\000\201\000\106\003\146\003\243\001\212\132\333\326\171\316\353"
+  "\132\222\214\151\112\000\000\205\043\002\011\101\001\307\071\370\275\367\275\256\163\267\265\262"
+  "\224\341\000\005\003\310\033\201\351\043\004\311\033\207\013\004\003\005\003\106\003\201\105\003"
+  "\000\106\003\201\351\043\000\207\013\201\105\003\010\106\003\045\003\106\003\214\104\357\134\255"
+  "\114\207\013\005\003\106\003\201\105\003\000\207\013\201\351\043\002\105\003\045\003\207\013\204"
+  "\351\043\001\207\013\045\003\204\351\043\000\250\033\201\106\003\003\310\033\351\043\207\023\045"
+  "\003\201\105\003\000\106\003\201\351\043\000\106\003\201\105\003\000\106\003\201\351\043\001\207"
+  "\023\045\003\202\105\003\013\106\003\201\000\000\000\102\001\243\001\141\010\070\306\034\337\156"
+  "\153\360\173\216\163\050\102\207\313\122\010\253\122\060\204\121\214\060\204\226\265\266\265\151"
+  "\112\042\001\242\001\202\202\001\000\242\001\205\243\001\201\202\001\204\243\001\000\242\001\202"
+  "\202\001\000\242\001\204\243\001\201\202\001\202\243\001\204\202\001\201\243\001\204\202\001\000"
+  "\242\001\201\243\001\201\202\001\000\242\001\203\243\001\201\202\001\203\243\001\201\202\001\000"
+  "\242\001\203\243\001\000\102\001\203\000\000\006\020\204\373\336\125\245\156\153\121\214\055\143"
+  "\125\255\213\266\265\201\267\265\001\262\224\242\020\224\000\000\000\040\000\230\000\000\201\040"
+  "\000\226\000\000\006\303\030\373\336\232\316\156\153\121\204\257\163\014\133\216\121\214\001\162"
+  "\214\004\041\307\000\000\006\142\010\171\316\065\245\257\163\121\204\061\204\317\163\217\216\163"
+  "\000\343\030\310\000\000\002\050\102\115\143\162\214\221\222\224\001\014\143\041\000\333\000\000"
+  "\201\040\000\377\000\000\377\000\000\377\000\000\377\000\000\377\000\000\377\000\000\377\000\000"
+  "\377\000\000\377\000\000\377\000\000\377\000\000\377\000\000\377\000\000\377\000\000\377\000\000"
+  "\377\000\000\247\000\000\002\000\000\002\000\000\002\000\000\002\271\000\000\000\010\010\252\000"
+  "\000\000\377\377\206\000\000\000\377\377\206\000\000\000\377\377\202\000\000\000\377\377\000\010"
+  "\010\010\202\000\000\000\377\377\201\000\000\000\377\377\203\000\000\000\377\377\201\000\000\001"
+  "\377\377\040\000\202\000\000\000\377\377\201\000\000\000\377\377\203\000\000\000\377\377\202\000"
+  "\000\000\377\377\237\000\000\000\020\010\010\202\000\000\000\377\377\206\000\000\201\377\377\205"
+  "\000\000\202\377\377\001\000\000\377\377\202\000\000\004\377\377\000\000\377\377\000\000\377\377"
+  "\202\000\000\001\377\377\000\000\202\377\377\202\000\000\000\377\377\201\000\000\000\337\377\203"
+  "\000\000\000\377\377\206\000\000\000\377\377\203\000\000\000\030\010\010\277\000\000\000\040\010"
+  "\010\277\000\000\000\050\010\010\277\000\000\002\307\000\010\000\010\010\252\000\000\204\377\377"
+  "\204\000\000\000\377\377\201\000\000\000\377\377\203\000\000\000\377\377\201\000\000\010\010\010"
+  "\010\001\000\000\377\377\202\000\000\000\377\377\202\000\000\000\377\377\202\000\000\000\377\377"
+  "\202\000\000\000\377\377\202\000\000\000\377\377\201\000\000\000\377\377\203\000\000\000\377\377"
+  "\241\000\000\010\020\010\010\001\000\000\377\377\205\000\000\201\377\377\205\000\000\201\377\377"
+  "\202\000\000\202\377\377\001\000\000\377\377\206\000\000\000\377\377\202\000\000\004\377\377\337"
+  "\377\377\377\000\000\377\377\201\000\000\005\377\377\000\000\040\000\141\010\000\000\377\377\201"
+  "\000\000\005\377\377\000\000\141\010\377\377\000\000\377\377\202\000\000\201\377\377\000\000\000"
+  "\010\030\010\010\277\000\000\010\040\010\010\277\000\000\010\050\010\010\277\000\000\002\227\000"
+  "\020\000\010\010\274\000\000\202\377\377\020\010\010\010\203\000\000\002\377\377\000\000\040\000"
+  "\204\000\000\000\377\377\206\000\000\002\377\377\000\000\040\000\205\000\000\002\377\377\337\377"
+  "\377\377\237\000\000\020\020\010\010\222\000\000\203\377\377\001\000\000\377\377\201\000\000\201"
+  "\377\377\000\101\010\202\377\377\201\000\000\001\377\377\040\000\201\000\000\201\377\377\201\000"
+  "\000\000\377\377\202\000\000\201\377\377\201\000\000\000\377\377\202\000\000\201\377\377\201\000"
+  "\000\000\377\377\202\000\000\000\377\377\020\030\010\010\277\000\000\020\040\010\010\277\000\000"
+  "\020\050\010\010\277\000\000\002\240\000\030\000\010\010\272\000\000\201\377\377\202\000\000\030"
+  "\010\010\010\201\000\000\000\377\377\201\000\000\000\377\377\203\000\000\000\377\377\201\000\000"
+  "\000\377\377\203\000\000\000\377\377\201\000\000\000\377\377\204\000\000\201\377\377\242\000\000"
+  "\030\020\010\010\221\000\000\000\377\377\202\000\000\001\377\377\202\020\201\000\000\000\377\377"
+  "\202\000\000\000\377\377\202\000\000\000\377\377\202\000\000\000\377\377\202\000\000\000\377\377"
+  "\201\000\000\001\101\010\377\377\202\000\000\000\377\377\202\000\000\000\377\377\203\000\000\203"
+  "\377\377\000\000\000\030\030\010\010\277\000\000\030\040\010\010\277\000\000\030\050\010\010\277"
+  "\000\000\002\256\000\040\000\010\010\270\000\000\001\377\377\337\377\201\000\000\201\377\377\000"
+  "\000\000\040\010\010\010\201\377\377\201\000\000\000\377\377\201\000\000\201\377\377\202\000\000"
+  "\001\377\377\337\377\202\377\377\202\000\000\000\377\377\202\000\000\000\377\377\203\000\000\202"
+  "\377\377\237\000\000\040\020\010\010\217\000\000\000\377\377\203\000\000\003\175\357\202\020\000"
+  "\000\377\377\203\000\000\007\377\377\000\000\377\377\000\000\377\377\000\000\040\000\034\347\201"
+  "\000\000\002\377\377\000\000\377\377\201\000\000\000\377\377\201\000\000\000\377\377\201\000\000"
+  "\201\377\377\202\000\000\000\377\377\201\000\000\201\377\377\202\000\000\000\377\377\040\030\010"
+  "\010\277\000\000\040\040\010\010\277\000\000\002\350\000\050\000\010\010\244\000\000\000\377\377"
+  "\206\000\000\000\377\377\206\000\000\000\377\377\206\000\000\202\377\377\050\010\010\010\204\000"
+  "\000\000\377\377\206\000\000\002\377\377\000\000\040\000\204\000\000\000\377\377\206\000\000\202"
+  "\377\377\237\000\000\050\020\010\010\206\000\000\000\377\377\207\000\000\202\377\377\203\000\000"
+  "\201\377\377\000\242\020\204\000\000\001\377\377\141\010\205\000\000\000\377\377\206\000\000\000"
+  "\377\377\206\000\000\000\377\377\202\000\000\000\377\377\202\000\000\000\377\377\050\030\010\010"
+  "\274\000\000\002\212\122\115\153\313\132\050\040\010\010\203\000\000\003\252\122\115\153\054\143"
+  "\115\153\203\000\000\000\115\153\202\054\143\203\000\000\000\155\153\202\054\143\203\000\000\001"
+  "\313\132\115\153\201\054\143\203\000\000\000\145\051\202\054\143\204\000\000\000\307\071\201\054"
+  "\143\205\000\000\001\050\102\054\143\205\000\000\001\101\010\212\122\050\050\010\010\206\000\000"
+  "\000\202\020\267\000\000\002\163\001\060\000\010\010\271\000\000\000\377\377\202\000\000\001\377"
+  "\377\000\000\060\010\010\010\002\377\377\000\000\377\377\202\000\000\002\377\377\000\000\377\377"
+  "\201\000\000\002\377\377\040\000\377\377\201\000\000\000\377\377\201\000\000\002\377\377\000\000"
+  "\377\377\205\000\000\000\377\377\206\000\000\001\377\377\040\000\203\000\000\201\377\377\000\242"
+  "\020\222\000\000\060\020\010\010\222\000\000\202\377\377\000\343\030\202\000\000\000\377\377\202"
+  "\000\000\000\377\377\202\000\000\001\377\377\141\010\201\000\000\000\377\377\202\000\000\001\377"
+  "\377\141\010\201\000\000\000\377\377\202\000\000\000\377\377\202\000\000\000\377\377\203\000\000"
+  "\202\377\377\001\343\030\000\000\060\030\010\010\267\000\000\000\343\030\206\000\000\060\040\010"
+  "\010\001\014\143\343\030\205\000\000\002\115\153\353\132\303\030\204\000\000\003\054\143\115\153"
+  "\252\122\202\020\203\000\000\202\054\143\001\212\122\101\010\202\000\000\203\054\143\001\111\112"
+  "\040\000\201\000\000\204\054\143\000\347\071\201\000\000\205\054\143\001\246\061\000\000\205\054"
+  "\143\001\014\143\044\041\060\050\010\010\000\313\132\204\054\143\003\115\153\353\132\303\030\313"
+  "\132\204\054\143\003\115\153\000\000\004\041\014\143\204\054\143\201\000\000\000\105\051\204\054"
+  "\143\202\000\000\001\145\051\115\153\202\054\143\202\000\000\002\040\000\246\061\155\153\201\054"
+  "\143\203\000\000\003\101\010\347\071\155\153\054\143\204\000\000\002\141\010\111\112\115\153\060"
+  "\060\010\010\205\000\000\001\202\020\212\122\206\000\000\000\343\030\257\000\000\002\057\002\070"
+  "\010\010\010\205\000\000\201\054\143\204\000\000\202\054\143\203\000\000\001\044\041\115\153\201"
+  "\054\143\203\000\000\001\010\102\115\153\201\054\143\203\000\000\001\010\102\115\153\201\054\143"
+  "\203\000\000\001\010\102\115\153\201\054\143\203\000\000\001\010\102\115\153\201\054\143\203\000"
+  "\000\001\010\102\115\153\201\054\143\070\020\010\010\203\000\000\001\010\102\115\153\201\054\143"
+  "\203\000\000\001\010\102\115\153\201\054\143\203\000\000\001\010\102\115\153\201\054\143\203\000"
+  "\000\001\010\102\115\153\201\054\143\203\000\000\001\010\102\115\153\201\054\143\203\000\000\001"
+  "\010\102\115\153\201\054\143\203\000\000\001\010\102\115\153\201\054\143\203\000\000\001\010\102"
+  "\115\153\201\054\143\070\030\010\010\203\000\000\001\010\102\115\153\201\054\143\203\000\000\001"
+  "\010\102\115\153\201\054\143\203\000\000\001\010\102\115\153\201\054\143\203\000\000\001\010\102"
+  "\115\153\201\054\143\203\000\000\001\010\102\115\153\201\054\143\203\000\000\001\010\102\115\153"
+  "\201\054\143\203\000\000\001\010\102\115\153\201\054\143\203\000\000\003\010\102\115\153\054\143"
+  "\111\112\070\040\010\010\203\000\000\003\010\102\115\153\212\122\141\010\203\000\000\002\050\102"
+  "\014\143\303\030\204\000\000\001\004\041\044\041\210\000\000\000\205\040\205\000\000\001\041\010"
+  "\156\131\205\000\000\001\247\050\322\171\204\000\000\002\001\000\156\131\322\171\204\000\000\000"
+  "\143\030\201\322\171\070\050\010\010\000\343\030\203\000\000\000\351\070\201\322\171\001\313\132"
+  "\303\030\202\000\000\000\115\131\201\322\171\002\115\153\212\122\202\020\201\000\000\202\322\171"
+  "\002\054\143\155\153\206\061\201\000\000\202\322\171\002\054\143\115\153\307\071\201\000\000\202"
+  "\322\171\002\054\143\115\153\054\143\201\000\000\202\322\171\002\054\143\115\153\054\143\201\000"
+  "\000\202\322\171\202\054\143\201\000\000\000\114\121\201\322\171\070\060\010\010\005\115\153\054"
+  "\143\155\153\101\010\000\000\310\060\201\322\171\005\313\132\054\143\115\153\145\051\000\000\103"
+  "\020\201\322\171\003\044\041\353\132\115\153\212\122\201\000\000\011\115\131\322\171\000\000\145"
+  "\051\014\143\054\143\242\020\000\000\205\040\322\171\201\000\000\000\246\061\201\054\143\002\000"
+  "\000\001\000\054\121\202\000\000\004\206\061\054\143\303\030\000\000\144\030\203\000\000\001\202"
+  "\020\141\010\211\000\000\002\222\002\100\000\010\010\235\000\000\001\202\020\054\143\204\000\000"
+  "\000\242\020\201\054\143\204\000\000\202\054\143\203\000\000\000\141\010\202\054\143\203\000\000"
+  "\001\202\020\014\143\201\054\143\100\010\010\010\000\054\143\202\000\000\001\202\020\014\143\203"
+  "\054\143\201\000\000\001\202\020\014\143\201\054\143\001\115\153\054\143\201\000\000\001\202\020"
+  "\014\143\203\054\143\201\000\000\001\202\020\014\143\203\054\143\201\000\000\001\202\020\014\143"
+  "\203\054\143\201\000\000\001\202\020\014\143\203\054\143\201\000\000\001\202\020\014\143\203\054"
+  "\143\201\000\000\001\202\020\014\143\201\054\143\100\020\010\010\201\054\143\201\000\000\001\202"
+  "\020\014\143\203\054\143\201\000\000\001\202\020\014\143\203\054\143\201\000\000\001\202\020\014"
+  "\143\203\054\143\201\000\000\001\202\020\014\143\203\054\143\201\000\000\001\202\020\014\143\203"
+  "\054\143\201\000\000\001\202\020\014\143\203\054\143\201\000\000\001\202\020\014\143\203\054\143"
+  "\201\000\000\001\202\020\014\143\201\054\143\100\030\010\010\201\054\143\201\000\000\001\202\020"
+  "\014\143\203\054\143\201\000\000\001\202\020\014\143\203\054\143\201\000\000\002\202\020\054\143"
+  "\155\153\202\054\143\201\000\000\003\202\020\054\143\343\030\101\010\201\054\143\205\000\000\001"
+  "\054\143\313\132\204\000\000\002\205\040\212\122\242\020\201\000\000\001\041\010\310\060\201\322"
+  "\171\000\141\010\201\000\000\001\205\040\261\161\202\322\171\100\040\010\010\002\000\000\001\000"
+  "\310\070\204\322\171\001\001\000\352\100\205\322\171\000\310\070\214\322\171\001\217\141\206\050"
+  "\204\322\171\002\114\121\042\010\000\000\203\322\171\001\115\121\041\010\201\000\000\203\322\171"
+  "\000\042\010\201\000\000\000\040\000\202\322\171\000\246\050\201\000\000\001\040\000\064\245\100"
+  "\050\010\010\201\322\171\001\156\141\042\010\201\000\000\001\155\153\377\377\201\322\171\000\351"
+  "\070\201\000\000\002\141\010\236\367\377\377\201\322\171\000\246\050\201\000\000\000\353\132\201"
+  "\377\377\201\322\171\000\205\040\201\000\000\202\377\377\201\322\171\000\205\040\201\000\000\202"
+  "\377\377\201\322\171\000\205\040\201\000\000\202\377\377\201\322\171\000\307\060\201\000\000\000"
+  "\307\071\201\377\377\201\322\171\001\053\111\041\010\201\000\000\001\131\316\377\377\100\060\010"
+  "\010\202\322\171\000\103\020\201\000\000\001\206\061\377\377\202\322\171\000\012\101\202\000\000"
+  "\000\252\122\203\322\171\000\205\040\202\000\000\204\322\171\000\205\040\201\000\000\205\322\171"
+  "\001\307\060\041\010\206\322\171\001\054\121\247\050\206\322\171\001\000\000\310\060\205\322\171"
+  "\100\070\010\010\201\000\000\000\246\050\204\322\171\202\000\000\001\103\020\115\131\202\322\171"
+  "\204\000\000\002\206\050\157\141\322\171\206\000\000\000\144\030\237\000\000\002\066\002\110\000"
+  "\010\010\227\000\000\001\054\143\101\010\205\000\000\201\054\143\000\101\010\204\000\000\202\054"
+  "\143\204\000\000\002\054\143\115\153\054\143\203\000\000\003\004\041\054\143\115\153\054\143\202"
+  "\000\000\001\105\051\054\143\110\010\010\010\002\054\143\115\153\054\143\201\000\000\001\040\000"
+  "\313\132\201\054\143\001\115\153\054\143\201\000\000\001\141\010\353\132\201\054\143\001\115\153"
+  "\054\143\201\000\000\001\303\030\353\132\201\054\143\001\115\153\054\143\201\000\000\001\303\030"
+  "\353\132\201\054\143\001\115\153\054\143\201\000\000\001\303\030\353\132\201\054\143\001\115\153"
+  "\054\143\201\000\000\001\303\030\353\132\201\054\143\001\115\153\054\143\201\000\000\001\303\030"
+  "\353\132\201\054\143\001\115\153\054\143\201\000\000\002\303\030\353\132\054\143\110\020\010\010"
+  "\002\054\143\115\153\054\143\201\000\000\001\303\030\353\132\201\054\143\001\115\153\054\143\201"
+  "\000\000\001\303\030\353\132\201\054\143\001\115\153\054\143\201\000\000\001\303\030\353\132\201"
+  "\054\143\001\115\153\054\143\201\000\000\001\303\030\353\132\201\054\143\001\115\153\054\143\201"
+  "\000\000\001\303\030\353\132\201\054\143\001\115\153\054\143\201\000\000\001\303\030\353\132\201"
+  "\054\143\001\115\153\054\143\201\000\000\001\303\030\353\132\201\054\143\001\115\153\054\143\201"
+  "\000\000\002\303\030\353\132\054\143\110\030\010\010\002\054\143\115\153\054\143\201\000\000\005"
+  "\303\030\353\132\054\143\115\153\155\153\054\143\201\000\000\005\303\030\054\143\115\153\050\102"
+  "\206\061\303\030\201\000\000\003\101\010\044\041\246\061\040\000\211\000\000\005\102\020\144\030"
+  "\103\020\041\010\000\000\053\111\226\322\171\110\040\010\010\212\322\171\000\220\151\201\217\141"
+  "\201\322\171\002\115\121\310\060\205\040\202\144\030\002\205\040\310\060\042\010\217\000\000\007"
+  "\343\030\121\214\030\306\232\326\030\306\121\214\343\030\020\204\216\377\377\110\050\010\010\277"
+  "\377\377\110\060\010\010\207\377\377\000\236\367\206\377\377\007\206\061\266\265\074\347\175\357"
+  "\236\367\175\357\074\347\327\275\201\000\000\004\145\051\014\143\155\153\014\143\206\061\210\000"
+  "\000\001\246\050\102\020\204\000\000\003\102\020\322\171\156\131\054\121\202\012\101\001\054\121"
+  "\156\131\207\322\171\110\070\010\010\227\322\171\001\351\100\156\131\204\322\171\000\156\131\202"
+  "\000\000\002\042\010\102\020\042\010\231\000\000\002\221\002\120\000\010\010\257\000\000\201\054"
+  "\143\000\242\020\204\000\000\202\054\143\000\242\020\203\000\000\120\010\010\010\202\054\143\000"
+  "\050\102\203\000\000\201\054\143\002\115\153\151\112\040\000\202\000\000\202\054\143\000\212\122"
+  "\203\000\000\202\054\143\000\212\122\202\000\000\000\040\000\202\054\143\000\212\122\201\000\000"
+  "\000\040\000\203\054\143\000\212\122\201\000\000\000\105\051\203\054\143\000\212\122\201\000\000"
+  "\000\246\061\203\054\143\000\212\122\201\000\000\001\307\071\054\143\120\020\010\010\202\054\143"
+  "\000\212\122\201\000\000\000\307\071\203\054\143\000\212\122\201\000\000\000\307\071\203\054\143"
+  "\000\212\122\201\000\000\000\307\071\203\054\143\000\212\122\201\000\000\000\307\071\203\054\143"
+  "\000\212\122\201\000\000\000\307\071\203\054\143\000\212\122\201\000\000\000\307\071\203\054\143"
+  "\000\212\122\201\000\000\000\307\071\203\054\143\000\212\122\201\000\000\001\307\071\054\143\120"
+  "\030\010\010\202\054\143\000\212\122\201\000\000\002\307\071\054\143\115\153\201\054\143\000\212"
+  "\122\201\000\000\005\307\071\054\143\111\112\014\143\155\153\252\122\201\000\000\005\307\071\054"
+  "\143\040\000\101\010\044\041\307\071\201\000\000\001\307\071\054\143\205\000\000\004\307\071\054"
+  "\143\054\121\247\050\041\010\202\000\000\001\105\051\014\143\202\322\171\001\351\100\102\020\201"
+  "\000\000\000\004\041\204\322\171\002\247\060\041\000\000\000\120\040\010\010\205\322\171\001\012"
+  "\111\042\010\206\322\171\001\054\121\114\121\206\322\171\002\042\010\246\050\156\131\204\322\171"
+  "\201\000\000\001\102\020\053\111\203\322\171\202\000\000\001\042\010\054\121\202\322\171\000\222"
+  "\224\202\000\000\001\143\030\156\141\201\322\171\001\377\377\367\275\202\000\000\000\310\060\201"
+  "\322\171\120\050\010\010\201\377\377\000\121\214\201\000\000\002\103\020\156\131\322\171\201\377"
+  "\377\001\074\347\343\030\201\000\000\001\053\111\322\171\201\377\377\001\276\367\256\163\201\000"
+  "\000\001\310\070\322\171\203\377\377\201\000\000\001\246\050\322\171\203\377\377\201\000\000\001"
+  "\246\050\322\171\201\377\377\001\337\377\377\377\201\000\000\001\247\060\322\171\201\377\377\001"
+  "\175\357\313\132\201\000\000\001\351\100\322\171\201\377\377\000\232\326\202\000\000\001\054\121"
+  "\322\171\120\060\010\010\002\377\377\236\367\050\102\201\000\000\004\205\040\220\151\322\171\236"
+  "\367\115\153\202\000\000\000\012\111\201\322\171\000\307\071\202\000\000\000\246\050\202\322\171"
+  "\202\000\000\001\205\040\260\151\202\322\171\002\000\000\041\010\307\060\204\322\171\001\246\050"
+  "\054\121\224\322\171\000\351\070\120\070\010\010\205\322\171\001\310\070\000\000\203\322\171\001"
+  "\217\151\145\040\201\000\000\202\322\171\000\307\060\203\000\000\001\012\101\145\040\245\000\000"
+  "\002\200\001\130\010\010\010\227\000\000\201\054\143\001\000\000\040\000\203\000\000\202\115\153"
+  "\204\000\000\203\054\143\203\000\000\203\054\143\203\000\000\203\054\143\203\000\000\130\020\010"
+  "\010\203\054\143\203\000\000\203\054\143\203\000\000\203\054\143\203\000\000\203\054\143\203\000"
+  "\000\203\054\143\203\000\000\203\054\143\203\000\000\203\054\143\203\000\000\203\054\143\203\000"
+  "\000\130\030\010\010\203\054\143\203\000\000\203\054\143\203\000\000\203\054\143\203\000\000\203"
+  "\054\143\203\000\000\203\054\143\203\000\000\203\054\143\203\000\000\000\313\132\202\054\143\203"
+  "\000\000\001\242\020\313\132\201\054\143\203\000\000\130\040\010\010\003\000\000\303\030\353\132"
+  "\054\143\203\000\000\003\041\010\000\000\044\041\054\143\203\000\000\000\053\111\201\000\000\000"
+  "\307\071\203\000\000\003\322\171\310\070\000\000\101\010\203\000\000\201\322\171\000\102\020\204"
+  "\000\000\201\322\171\000\054\121\204\000\000\202\322\171\000\103\020\203\000\000\202\322\171\000"
+  "\352\100\203\000\000\130\050\010\010\203\322\171\203\000\000\203\322\171\000\041\010\202\000\000"
+  "\203\322\171\000\144\040\202\000\000\203\322\171\000\206\050\202\000\000\203\322\171\000\246\050"
+  "\202\000\000\203\322\171\000\206\050\202\000\000\203\322\171\000\144\030\202\000\000\203\322\171"
+  "\000\001\010\202\000\000\130\060\010\010\202\322\171\000\156\131\203\000\000\202\322\171\000\310"
+  "\060\203\000\000\202\322\171\000\041\010\203\000\000\201\322\171\000\012\101\204\000\000\201\322"
+  "\171\000\041\010\204\000\000\001\322\171\206\040\205\000\000\000\351\070\206\000\000\000\001\000"
+  "\206\000\000\002\000\000\002\000\000\002\000\000\002\374\000\000\000\010\010\277\000\000\000\010"
+  "\010\010\277\000\000\000\020\010\010\277\000\000\000\050\010\010\261\000\000\001\202\020\242\020"
+  "\204\000\000\003\303\030\337\377\377\377\266\265\202\000\000\000\060\010\010\001\000\000\363\234"
+  "\202\377\377\000\303\030\202\000\000\000\171\316\202\377\377\000\317\173\202\000\000\000\236\367"
+  "\203\377\377\202\000\000\204\377\377\000\353\132\201\000\000\201\377\377\000\236\367\201\377\377"
+  "\000\327\275\201\000\000\201\377\377\000\064\245\202\377\377\001\101\010\000\000\201\377\377\001"
+  "\060\204\357\173\201\377\377\001\363\234\000\000\201\377\377\004\216\163\141\010\337\377\377\377"
+  "\236\367\000\070\010\010\000\000\000\201\377\377\002\252\122\000\000\272\326\201\377\377\000\000"
+  "\000\201\377\377\002\347\071\000\000\014\143\201\377\377\000\000\000\201\377\377\000\004\041\201"
+  "\000\000\002\276\367\377\377\000\000\201\377\377\000\101\010\201\000\000\002\262\224\377\377\000"
+  "\000\201\377\377\202\000\000\004\004\041\377\377\000\000\034\347\333\336\203\000\000\000\242\020"
+  "\217\000\000\002\371\000\010\000\010\010\277\000\000\010\010\010\010\277\000\000\010\020\010\010"
+  "\277\000\000\010\050\010\010\263\000\000\002\040\000\242\020\040\000\204\000\000\003\034\347\377"
+  "\377\135\357\000\000\010\060\010\010\202\000\000\000\020\204\202\377\377\000\246\061\201\000\000"
+  "\001\040\000\175\357\202\377\377\000\111\112\201\000\000\000\044\041\203\377\377\000\014\143\201"
+  "\000\000\000\266\265\203\377\377\002\020\204\000\000\242\020\201\377\377\005\135\357\337\377\377"
+  "\377\024\245\000\000\317\173\201\377\377\005\020\204\236\367\377\377\030\306\000\000\373\336\201"
+  "\377\377\004\105\051\272\326\377\377\034\347\010\102\201\377\377\002\135\357\000\000\266\265\201"
+  "\377\377\010\070\010\010\000\236\367\201\377\377\002\313\132\000\000\323\234\203\377\377\003\236"
+  "\367\141\010\000\000\357\173\203\377\377\000\070\306\201\000\000\000\014\143\203\377\377\000\246"
+  "\061\201\000\000\000\010\102\202\377\377\000\070\306\202\000\000\000\145\051\201\377\377\001\307"
+  "\071\040\000\202\000\000\000\004\041\201\034\347\217\000\000\002\337\000\020\000\010\010\277\000"
+  "\000\020\010\010\010\277\000\000\020\020\010\010\277\000\000\020\060\010\010\221\000\000\000\317"
+  "\173\201\161\214\201\000\000\000\101\010\201\000\000\000\373\336\201\377\377\002\000\000\044\041"
+  "\377\377\201\000\000\005\373\336\377\377\337\377\000\000\020\204\377\377\201\000\000\005\373\336"
+  "\377\377\337\377\000\000\327\275\377\377\201\000\000\005\373\336\377\377\337\377\000\000\070\306"
+  "\377\377\201\000\000\005\373\336\377\377\337\377\000\000\070\306\377\377\020\070\010\010\201\000"
+  "\000\005\373\336\377\377\337\377\000\000\070\306\377\377\201\000\000\005\373\336\377\377\337\377"
+  "\000\000\070\306\377\377\201\000\000\005\373\336\377\377\337\377\000\000\030\306\377\377\201\000"
+  "\000\005\373\336\377\377\337\377\000\000\363\234\377\377\201\000\000\005\373\336\377\377\337\377"
+  "\000\000\151\112\377\377\201\000\000\002\030\306\034\347\333\336\201\000\000\000\155\153\217\000"
+  "\000\002\130\001\030\000\010\010\277\000\000\030\010\010\010\226\000\000\000\000\350\205\000\000"
+  "\201\000\350\204\000\000\000\141\100\201\000\350\204\000\000\202\000\350\203\000\000\000\302\200"
+  "\202\000\350\203\000\000\203\000\350\030\020\010\010\202\000\000\000\302\200\203\000\350\202\000"
+  "\000\204\000\350\202\000\000\204\000\350\201\000\000\000\100\000\204\000\350\201\000\000\000\343"
+  "\210\204\000\350\201\000\000\205\000\350\201\000\000\000\147\362\204\000\350\201\000\000\204\000"
+  "\350\000\271\376\030\030\010\010\201\000\000\000\047\372\202\000\350\001\057\364\377\377\201\000"
+  "\000\000\047\342\202\000\350\201\377\377\201\000\000\202\000\350\202\377\377\201\000\000\002\342"
+  "\170\000\350\322\364\202\377\377\202\000\000\000\006\372\203\377\377\202\000\000\000\276\367\203"
+  "\377\377\202\000\000\000\276\367\203\377\377\202\000\000\000\145\051\203\377\377\030\040\010\010"
+  "\203\000\000\000\175\357\202\377\377\203\000\000\000\145\051\202\377\377\204\000\000\000\236\367"
+  "\201\377\377\205\000\000\201\377\377\205\000\000\001\060\204\377\377\206\000\000\000\232\276\217"
+  "\000\000\030\060\010\010\217\000\000\001\262\224\070\306\203\131\316\001\030\306\115\153\220\377"
+  "\377\000\262\224\204\212\122\001\252\122\373\336\206\000\000\000\367\275\206\000\000\030\070\010"
+  "\010\000\367\275\206\000\000\000\131\316\206\000\000\001\377\377\141\010\205\000\000\217\377\377"
+  "\000\034\347\205\377\377\000\367\275\217\000\000\002\303\001\040\000\010\010\246\000\000\000\000"
+  "\350\203\000\000\000\000\010\202\000\350\202\000\000\000\242\220\203\000\350\201\000\000\205\000"
+  "\350\040\010\010\010\000\000\000\245\000\350\000\377\377\205\000\350\001\157\364\377\377\204\000"
+  "\350\000\007\352\201\377\377\204\000\350\202\377\377\040\020\010\010\203\000\350\203\377\377\203"
+  "\000\350\203\377\377\203\000\350\203\377\377\204\000\350\202\377\377\001\000\350\254\363\202\000"
+  "\350\000\322\374\201\377\377\005\002\351\377\377\245\351\000\350\003\351\000\340\204\377\377\003"
+  "\000\350\343\350\101\350\040\350\203\377\377\004\164\365\000\350\104\351\000\350\275\377\040\030"
+  "\010\010\203\377\377\003\000\350\242\350\302\350\000\350\204\377\377\002\000\340\004\351\000\350"
+  "\204\377\377\000\315\363\201\000\350\205\377\377\201\000\350\205\377\377\001\170\376\000\350\205"
+  "\377\377\001\073\377\000\350\205\377\377\201\000\350\204\377\377\000\352\362\201\000\350\040\040"
+  "\010\010\203\377\377\000\127\376\202\000\350\203\377\377\203\000\350\202\377\377\204\000\350\201"
+  "\377\377\000\161\364\204\000\350\001\377\377\174\377\205\000\350\000\377\377\206\000\350\000\053"
+  "\343\206\000\350\000\000\000\206\000\350\040\050\010\010\201\000\000\000\343\270\204\000\350\202"
+  "\000\000\000\141\120\203\000\350\204\000\000\202\000\350\206\000\000\000\343\260\237\000\000\040"
+  "\060\010\010\221\000\000\000\222\224\204\161\214\001\145\051\000\000\205\377\377\001\313\132\000"
+  "\000\205\377\377\001\343\030\000\000\201\377\377\000\014\143\202\111\112\201\000\000\201\377\377"
+  "\000\004\041\204\000\000\201\377\377\000\004\041\202\000\000\040\070\010\010\201\000\000\205\377"
+  "\377\201\000\000\205\377\377\201\000\000\201\377\377\203\236\367\001\020\204\000\000\201\377\377"
+  "\000\242\020\202\000\000\001\115\153\000\000\201\377\377\000\004\041\202\000\000\001\040\000\000"
+  "\000\201\074\347\000\343\030\222\000\000\002\240\001\050\000\010\010\223\000\000\001\141\120\343"
+  "\270\201\000\350\001\000\000\242\210\245\000\350\050\010\010\010\220\000\350\000\241\350\205\000"
+  "\350\202\377\377\000\342\350\203\000\350\203\377\377\203\000\350\203\377\377\000\362\364\202\000"
+  "\350\204\377\377\202\000\350\205\377\377\201\000\350\050\020\010\010\205\377\377\001\251\362\000"
+  "\350\206\377\377\000\000\350\206\377\377\000\134\377\247\377\377\050\030\010\010\207\377\377\000"
+  "\312\362\206\377\377\001\000\350\234\377\205\377\377\201\000\350\205\377\377\201\000\350\000\056"
+  "\364\204\377\377\202\000\350\204\377\377\203\000\350\203\377\377\203\000\350\000\117\364\202\377"
+  "\377\050\040\010\010\204\000\350\202\377\377\205\000\350\201\377\377\205\000\350\001\231\376\377"
+  "\377\206\000\350\000\377\377\206\000\350\000\047\362\227\000\350\050\050\010\010\237\000\350\001"
+  "\000\000\202\150\205\000\350\205\000\000\001\201\130\242\210\217\000\000\050\060\010\010\217\000"
+  "\000\002\161\214\222\224\212\122\203\000\000\000\161\214\202\377\377\003\115\153\000\000\101\010"
+  "\175\357\203\377\377\002\034\347\000\000\014\143\201\377\377\001\010\102\232\326\201\377\377\001"
+  "\000\000\064\245\201\377\377\001\000\000\054\143\201\377\377\013\000\000\327\275\377\377\074\347"
+  "\000\000\121\214\377\377\276\367\000\000\327\275\377\377\232\326\050\070\010\010\202\377\377\004"
+  "\323\234\000\000\327\275\377\377\171\316\201\377\377\006\236\367\202\020\000\000\327\275\377\377"
+  "\272\326\236\367\201\377\377\002\226\265\000\000\226\265\201\377\377\005\000\000\226\265\377\377"
+  "\276\367\000\000\020\204\201\377\377\005\000\000\020\204\377\377\337\377\000\000\004\041\201\377"
+  "\377\003\000\000\256\163\034\347\373\336\201\000\000\001\353\132\373\336\217\000\000\002\225\001"
+  "\060\000\010\010\217\000\000\203\000\350\001\343\260\141\120\201\000\000\247\000\350\060\010\010"
+  "\010\236\000\350\000\331\376\205\000\350\001\144\351\377\377\205\000\350\201\377\377\204\000\350"
+  "\000\174\377\201\377\377\203\000\350\000\160\364\202\377\377\060\020\010\010\203\000\350\203\377"
+  "\377\202\000\350\204\377\377\202\000\350\000\244\351\203\377\377\201\000\350\001\044\351\000\350"
+  "\204\377\377\003\000\350\343\350\242\350\000\350\203\377\377\004\261\364\000\350\105\351\000\350"
+  "\114\363\203\377\377\003\000\350\040\350\004\351\000\340\204\377\377\004\000\350\004\351\201\350"
+  "\000\340\377\377\060\030\010\010\202\377\377\004\214\363\000\350\104\351\000\350\027\376\203\377"
+  "\377\003\000\350\302\350\343\350\000\350\203\377\377\003\372\376\000\340\044\351\000\350\204\377"
+  "\377\000\012\363\201\000\350\205\377\377\201\000\350\205\377\377\001\032\377\000\350\206\377\377"
+  "\000\000\350\205\377\377\001\372\376\000\350\060\040\010\010\205\377\377\201\000\350\204\377\377"
+  "\000\043\351\201\000\350\203\377\377\000\261\364\202\000\350\203\377\377\203\000\350\202\377\377"
+  "\204\000\350\002\057\364\033\377\044\351\224\000\350\060\050\010\010\251\000\350\002\302\230\202"
+  "\140\040\010\222\000\000\060\060\010\010\217\000\000\000\070\306\203\131\316\002\226\265\347\071"
+  "\000\000\206\377\377\000\115\153\207\377\377\000\323\234\202\347\071\001\111\112\175\357\201\377"
+  "\377\204\000\000\000\060\204\201\377\377\204\000\000\000\115\153\201\377\377\060\070\010\010\204"
+  "\000\000\000\115\153\201\377\377\204\000\000\000\216\163\201\377\377\000\242\020\203\000\000\000"
+  "\266\265\220\377\377\000\367\275\204\377\377\002\276\367\024\245\040\000\217\000\000\002\225\001"
+  "\070\000\010\010\227\000\000\000\202\150\206\000\000\202\000\350\204\000\000\202\000\350\000\101"
+  "\060\203\000\000\203\000\350\203\000\000\204\000\350\202\000\000\070\010\010\010\204\000\350\202"
+  "\000\000\205\000\350\201\000\000\205\000\350\001\202\170\000\000\201\377\377\000\163\375\203\000"
+  "\350\000\000\000\202\377\377\000\047\362\203\000\350\203\377\377\203\000\350\203\377\377\000\331"
+  "\376\202\000\350\204\377\377\202\000\350\070\020\010\010\205\377\377\201\000\350\205\377\377\001"
+  "\120\364\000\350\206\377\377\000\000\350\247\377\377\070\030\010\010\217\377\377\000\245\351\206"
+  "\377\377\001\000\350\231\376\205\377\377\201\000\350\205\377\377\201\000\350\000\154\363\204\377"
+  "\377\202\000\350\000\074\377\203\377\377\203\000\350\203\377\377\070\040\010\010\203\000\350\000"
+  "\113\363\202\377\377\204\000\350\202\377\377\205\000\350\201\377\377\205\000\350\001\124\375\377"
+  "\377\206\000\350\000\377\377\206\000\350\000\342\350\217\000\350\070\050\010\010\215\000\350\001"
+  "\202\150\000\000\204\000\350\202\000\000\201\000\350\000\343\300\204\000\000\000\242\200\236\000"
+  "\000\070\060\010\010\222\000\000\000\020\204\203\367\275\002\000\000\202\020\175\357\204\377\377"
+  "\001\000\000\252\122\205\377\377\001\242\020\060\204\201\377\377\000\226\265\202\353\132\001\303"
+  "\030\262\224\201\377\377\203\000\000\003\303\030\262\224\377\377\175\357\203\000\000\070\070\010"
+  "\010\003\303\030\262\224\377\377\135\357\203\000\000\003\303\030\262\224\377\377\276\367\203\000"
+  "\000\001\303\030\222\224\201\377\377\000\004\041\202\000\000\001\101\010\155\153\205\377\377\001"
+  "\000\000\206\061\205\377\377\201\000\000\001\313\132\034\347\203\377\377\217\000\000\002\257\001"
+  "\100\000\010\010\277\000\000\100\010\010\010\247\000\000\000\040\020\206\000\000\000\000\350\206"
+  "\000\000\001\000\350\343\270\205\000\000\100\020\010\010\201\000\350\000\000\010\204\000\000\202"
+  "\000\350\204\000\000\202\000\350\000\302\220\203\000\000\203\000\350\203\000\000\000\103\351\203"
+  "\000\350\202\000\000\000\377\377\203\000\350\000\302\210\201\000\000\001\377\377\027\376\203\000"
+  "\350\201\000\000\201\377\377\000\002\351\203\000\350\000\000\000\100\030\010\010\202\377\377\203"
+  "\000\350\000\040\060\202\377\377\000\057\364\202\000\350\000\343\350\203\377\377\202\000\350\000"
+  "\145\361\204\377\377\202\000\350\204\377\377\002\016\364\000\350\343\260\205\377\377\001\000\350"
+  "\000\010\205\377\377\001\236\367\000\000\205\377\377\001\111\102\000\000\100\040\010\010\204\377"
+  "\377\000\337\377\201\000\000\204\377\377\000\266\265\201\000\000\203\377\377\000\276\367\202\000"
+  "\000\203\377\377\000\105\051\202\000\000\202\377\377\000\024\245\203\000\000\201\377\377\000\175"
+  "\357\204\000\000\001\377\377\276\367\205\000\000\000\241\360\206\000\000\100\050\010\010\277\000"
+  "\000\100\060\010\010\217\000\000\201\367\275\000\317\173\201\000\000\002\161\214\222\224\145\051"
+  "\202\377\377\001\252\122\000\000\201\377\377\000\212\122\202\377\377\004\161\214\000\000\337\377"
+  "\377\377\212\122\201\353\132\005\014\143\246\061\000\000\337\377\377\377\212\122\204\000\000\002"
+  "\337\377\377\377\165\255\204\000\000\000\337\377\201\377\377\100\070\010\010\204\000\000\000\337"
+  "\377\201\377\377\204\000\000\002\337\377\377\377\266\265\204\000\000\002\337\377\377\377\151\112"
+  "\202\377\377\004\030\306\000\000\337\377\377\377\212\122\202\377\377\004\024\245\000\000\337\377"
+  "\377\377\212\122\201\377\377\005\272\326\303\030\000\000\373\336\074\347\111\112\217\000\000\002"
+  "\265\000\110\000\010\010\277\000\000\110\010\010\010\277\000\000\110\020\010\010\277\000\000\110"
+  "\030\010\010\277\000\000\110\040\010\010\277\000\000\110\050\010\010\277\000\000\110\060\010\010"
+  "\223\000\000\002\111\112\161\214\060\204\204\000\000\002\060\204\377\377\175\357\204\000\000\002"
+  "\060\204\377\377\175\357\204\000\000\004\060\204\377\377\175\357\000\000\060\204\201\121\214\004"
+  "\060\204\070\306\377\377\175\357\000\000\205\377\377\001\175\357\000\000\110\070\010\010\205\377"
+  "\377\002\175\357\000\000\222\224\201\262\224\003\222\224\131\316\377\377\175\357\204\000\000\002"
+  "\020\204\377\377\175\357\204\000\000\002\060\204\377\377\175\357\204\000\000\002\060\204\377\377"
+  "\175\357\204\000\000\002\256\163\034\347\232\326\220\000\000\002\334\000\120\000\010\010\277\000"
+  "\000\120\010\010\010\277\000\000\120\020\010\010\277\000\000\120\030\010\010\277\000\000\120\040"
+  "\010\010\277\000\000\120\050\010\010\277\000\000\120\060\010\010\220\000\000\001\222\224\262\224"
+  "\201\000\000\000\262\224\201\161\214\000\000\000\201\377\377\201\000\000\202\377\377\000\000\000"
+  "\201\377\377\201\000\000\202\377\377\000\000\000\201\377\377\201\000\000\201\377\377\001\252\122"
+  "\000\000\201\377\377\201\000\000\201\377\377\001\202\020\000\000\201\377\377\201\000\000\201\377"
+  "\377\000\040\000\120\070\010\010\000\000\000\201\377\377\201\000\000\201\377\377\001\236\367\000"
+  "\000\201\377\377\201\000\000\202\377\377\000\000\000\201\377\377\201\000\000\202\377\377\000\000"
+  "\000\201\377\377\201\000\000\201\377\377\001\101\010\000\000\201\377\377\201\000\000\201\377\377"
+  "\003\202\020\000\000\074\347\135\357\201\000\000\002\175\357\373\336\202\020\217\000\000\002\210"
+  "\000\130\010\010\010\277\000\000\130\020\010\010\277\000\000\130\030\010\010\277\000\000\130\040"
+  "\010\010\277\000\000\130\050\010\010\277\000\000\130\060\010\010\217\000\000\203\161\214\001\121"
+  "\214\044\041\201\000\000\205\377\377\001\151\112\000\000\205\377\377\001\030\306\000\000\202\111"
+  "\112\003\050\102\034\347\377\377\236\367\204\000\000\000\353\132\201\377\377\204\000\000\000\020"
+  "\204\201\377\377\000\000\000\130\070\010\010\203\236\367\201\377\377\001\074\347\000\000\205\377"
+  "\377\001\363\234\000\000\204\377\377\001\074\347\004\041\250\000\000\002\000\000\002\000\000\002"
+  "\000\000\002\001\001\000\030\010\010\207\000\000\001\100\000\305\002\205\106\003\001\241\000\146"
+  "\003\205\045\003\001\241\000\106\003\205\045\003\001\241\000\106\003\204\045\003\002\305\002\241"
+  "\000\106\003\204\045\003\002\243\001\241\000\106\003\203\045\003\003\345\002\303\030\241\000\106"
+  "\003\202\045\003\002\106\003\301\000\216\163\000\040\010\010\001\241\000\106\003\202\045\003\004"
+  "\043\002\343\030\373\336\241\000\106\003\201\045\003\005\005\003\200\000\125\245\333\336\241\000"
+  "\106\003\201\045\003\033\343\001\252\122\232\326\070\306\241\000\106\003\045\003\005\003\003\021"
+  "\165\255\272\326\024\245\201\000\106\003\146\003\243\001\212\132\333\326\171\316\353\132\000\000"
+  "\102\001\243\001\141\010\070\306\034\337\156\153\360\173\202\000\000\004\020\204\373\336\125\245"
+  "\156\153\121\214\201\000\000\005\303\030\373\336\232\316\156\153\121\204\257\163\000\050\010\010"
+  "\201\000\000\005\142\010\171\316\065\245\257\163\121\204\061\204\202\000\000\002\050\102\115\143"
+  "\162\214\201\222\224\257\000\000\000\060\010\010\277\000\000\000\070\010\010\277\000\000\002\051"
+  "\001\010\020\010\010\254\000\000\002\040\000\202\020\040\010\203\000\000\201\353\132\001\327\275"
+  "\317\163\202\000\000\004\044\041\070\306\166\255\121\204\370\275\010\030\010\010\201\000\000\075"
+  "\040\000\317\173\273\326\232\316\061\204\226\255\146\003\244\002\004\041\172\316\273\326\272\326"
+  "\165\255\262\224\045\003\100\000\363\234\374\336\364\234\367\275\232\326\357\173\202\001\151\112"
+  "\333\336\171\316\055\143\353\132\034\337\327\265\302\010\030\306\272\326\222\224\360\173\317\173"
+  "\222\224\374\336\055\153\232\326\131\306\156\153\121\214\014\143\145\051\171\316\367\275\333\336"
+  "\060\204\317\173\061\204\141\010\001\001\222\224\373\336\030\306\253\122\222\224\247\071\202\001"
+  "\204\002\044\031\010\040\010\010\014\273\326\354\132\162\214\156\153\241\010\105\003\106\003\300"
+  "\000\323\234\257\163\061\204\246\061\044\002\201\045\003\005\345\002\257\163\061\204\156\153\341"
+  "\000\005\003\201\045\003\004\105\003\156\153\162\214\003\031\043\002\203\045\003\002\222\214\151"
+  "\112\000\000\204\043\002\001\216\163\050\102\205\313\122\001\055\143\125\255\205\266\265\000\014"
+  "\133\206\121\214\010\050\010\010\000\317\163\206\216\163\207\222\224\257\000\000\010\060\010\010"
+  "\277\000\000\010\070\010\010\277\000\000\002\005\001\020\020\010\010\267\000\000\000\347\071\206"
+  "\000\000\020\030\010\010\000\165\255\206\000\000\002\267\265\054\143\303\001\204\106\003\003\327"
+  "\265\065\245\104\041\345\002\203\045\003\004\357\173\367\275\055\153\142\001\106\003\202\045\003"
+  "\004\256\163\166\255\327\265\243\030\204\002\202\045\003\004\232\326\216\163\327\275\161\214\200"
+  "\000\202\045\003\005\272\326\064\245\263\224\327\275\151\112\302\001\201\045\003\007\272\326\070"
+  "\306\121\214\226\265\024\235\043\021\345\002\045\003\020\040\010\010\047\216\163\034\337\222\224"
+  "\024\245\267\265\253\132\343\001\045\003\101\000\327\265\273\326\115\153\327\275\064\245\303\020"
+  "\345\002\343\001\350\101\333\336\327\275\256\163\030\276\155\153\341\000\045\003\002\011\363\234"
+  "\333\326\020\174\125\255\370\275\004\041\043\002\101\001\307\071\370\275\367\275\256\163\267\265"
+  "\262\224\201\313\122\004\253\122\060\204\121\214\060\204\226\265\206\266\265\201\267\265\207\121"
+  "\214\020\050\010\010\207\216\163\207\222\224\205\000\000\201\040\000\247\000\000\020\060\010\010"
+  "\277\000\000\020\070\010\010\277\000\000\002\017\001\030\010\010\010\277\000\000\030\020\010\010"
+  "\277\000\000\030\030\010\010\207\000\000\201\106\003\000\105\003\203\045\003\013\105\003\045\003"
+  "\004\003\060\155\364\225\324\215\323\215\222\175\316\134\045\003\344\002\331\306\203\377\377\040"
+  "\336\367\045\003\344\002\331\306\377\377\175\347\167\256\073\327\337\377\045\003\344\002\331\306"
+  "\377\377\230\266\005\003\344\002\162\175\045\003\344\002\331\306\377\377\230\266\106\003\045\003"
+  "\250\033\045\003\344\002\331\306\377\377\230\266\106\003\045\003\207\023\030\040\010\010\033\045"
+  "\003\344\002\331\306\377\377\230\266\106\003\005\003\113\074\045\003\344\002\331\306\377\377\372"
+  "\306\114\074\316\124\331\306\146\003\344\002\331\306\377\377\337\367\235\357\276\367\377\377\104"
+  "\002\344\002\270\276\337\377\202\276\367\003\134\337\341\000\005\003\310\033\201\351\043\005\311"
+  "\033\207\013\004\003\151\112\042\001\242\001\202\202\001\003\242\001\243\001\262\224\242\020\205"
+  "\000\000\001\162\214\004\041\205\000\000\030\050\010\010\001\216\163\343\030\205\000\000\001\014"
+  "\143\041\000\265\000\000\030\060\010\010\277\000\000\030\070\010\010\277\000\000\002\373\000\040"
+  "\000\010\010\277\000\000\040\010\010\010\277\000\000\040\020\010\010\277\000\000\040\030\010\010"
+  "\207\000\000\204\106\003\201\045\003\002\106\003\106\013\005\003\201\045\003\010\106\003\025\236"
+  "\365\225\053\064\134\337\352\053\005\003\045\003\106\003\201\377\377\005\357\134\377\377\235\357"
+  "\147\023\045\003\106\003\201\377\377\005\357\134\337\367\337\377\161\165\005\003\106\003\201\377"
+  "\377\005\357\134\175\347\377\377\066\246\045\003\106\003\201\377\377\005\357\134\175\347\377\377"
+  "\126\246\046\003\106\003\201\377\377\000\357\134\040\040\010\010\004\236\357\377\377\364\225\005"
+  "\003\106\003\201\377\377\005\357\134\377\377\337\377\215\104\005\003\106\003\201\377\377\005\357"
+  "\134\377\377\324\215\005\003\045\003\106\003\201\377\377\002\357\134\317\134\005\003\201\045\003"
+  "\000\106\003\201\377\377\002\316\124\005\003\106\003\201\105\003\000\106\003\201\351\043\000\207"
+  "\013\204\243\001\201\202\001\000\243\001\217\000\000\040\050\010\010\277\000\000\040\060\010\010"
+  "\277\000\000\040\070\010\010\277\000\000\002\375\000\050\000\010\010\277\000\000\050\010\010\010"
+  "\277\000\000\050\020\010\010\277\000\000\050\030\010\010\207\000\000\203\106\003\004\105\003\146"
+  "\003\207\013\146\003\005\003\201\045\003\011\046\003\060\145\066\246\167\266\126\246\005\003\045"
+  "\003\046\003\372\316\337\377\202\377\377\002\005\003\004\003\270\276\201\377\377\011\230\266\162"
+  "\175\230\266\004\003\113\074\276\367\377\377\025\236\005\003\304\002\201\344\002\016\060\155\337"
+  "\377\276\367\215\114\344\002\357\134\365\225\344\002\121\165\337\377\276\367\053\064\344\002\065"
+  "\236\377\377\050\040\010\010\001\004\003\316\124\201\336\367\012\316\124\344\002\357\134\025\236"
+  "\005\003\207\023\175\347\377\377\271\276\250\033\243\002\202\005\003\000\256\124\201\377\377\007"
+  "\174\347\033\317\134\337\005\003\045\003\005\003\215\114\235\357\202\337\367\201\105\003\005\106"
+  "\003\045\003\106\003\214\104\357\134\255\114\203\243\001\000\242\001\202\202\001\206\000\000\000"
+  "\040\000\207\000\000\050\050\010\010\277\000\000\050\060\010\010\277\000\000\050\070\010\010\277"
+  "\000\000\002\371\000\060\000\010\010\277\000\000\060\010\010\010\277\000\000\060\020\010\010\277"
+  "\000\000\060\030\010\010\207\000\000\000\105\003\203\106\003\000\105\003\201\045\003\002\121\165"
+  "\146\013\005\003\201\045\003\005\113\074\365\225\025\236\337\377\134\337\250\033\201\005\003\000"
+  "\060\155\201\377\377\005\337\377\276\367\323\215\004\003\005\003\060\145\201\377\377\002\316\124"
+  "\250\033\243\002\201\005\003\000\060\145\201\377\377\201\324\215\003\364\225\053\064\005\003\060"
+  "\145\202\377\377\201\337\377\002\357\134\005\003\060\145\201\377\377\060\040\010\010\005\167\266"
+  "\337\377\276\367\215\114\005\003\060\145\201\377\377\005\364\225\337\377\174\347\250\033\005\003"
+  "\060\145\201\377\377\002\337\377\377\377\162\165\201\005\003\000\060\145\201\377\377\005\336\367"
+  "\121\165\344\002\045\003\005\003\020\145\201\377\377\002\207\013\005\003\106\003\201\105\003\000"
+  "\207\013\201\351\043\000\242\001\204\243\001\201\202\001\217\000\000\060\050\010\010\277\000\000"
+  "\060\060\010\010\277\000\000\060\070\010\010\277\000\000\002\346\000\070\000\010\010\277\000\000"
+  "\070\010\010\010\277\000\000\070\020\010\010\277\000\000\070\030\010\010\207\000\000\201\106\003"
+  "\000\105\003\201\045\003\202\106\003\005\045\003\005\003\114\074\324\215\263\205\311\043\202\045"
+  "\003\004\005\003\061\155\377\377\276\367\114\074\202\045\003\004\005\003\060\155\337\377\236\357"
+  "\114\074\202\045\003\004\005\003\060\155\337\377\236\357\114\074\202\045\003\004\005\003\060\155"
+  "\337\377\236\357\114\074\202\045\003\004\005\003\060\155\337\377\236\357\114\074\201\045\003\070"
+  "\040\010\010\005\045\003\005\003\060\155\337\377\235\357\113\074\201\005\003\022\045\003\005\003"
+  "\060\155\337\377\276\367\161\165\215\114\215\104\045\003\005\003\060\155\337\377\377\377\276\367"
+  "\276\357\235\357\045\003\005\003\060\155\203\276\367\003\276\357\105\003\045\003\207\013\204\351"
+  "\043\202\243\001\204\202\001\217\000\000\070\050\010\010\277\000\000\070\060\010\010\277\000\000"
+  "\070\070\010\010\277\000\000\002\325\000\100\010\010\010\277\000\000\100\020\010\010\277\000\000"
+  "\100\030\010\010\207\000\000\201\106\003\204\045\003\002\105\003\045\003\004\003\203\324\215\003"
+  "\364\225\020\145\045\003\304\002\204\377\377\015\270\276\045\003\304\002\337\377\377\377\032\317"
+  "\066\236\066\246\121\165\045\003\304\002\337\377\377\377\222\175\201\045\003\013\005\003\045\003"
+  "\304\002\337\377\377\377\134\347\331\306\372\316\060\155\045\003\304\002\337\377\203\377\377\000"
+  "\323\215\100\040\010\010\004\045\003\344\002\337\377\377\377\126\246\201\256\124\005\352\053\250"
+  "\033\304\002\337\377\377\377\365\225\201\012\064\012\311\043\357\134\303\002\337\377\377\377\276"
+  "\367\235\357\236\357\126\246\357\134\303\002\203\276\367\003\337\367\167\256\207\013\045\003\204"
+  "\351\043\000\250\033\201\243\001\204\202\001\000\242\001\217\000\000\100\060\010\010\277\000\000"
+  "\100\070\010\010\277\000\000\002\347\000\110\030\010\010\207\000\000\201\106\003\002\105\003\045"
+  "\003\105\003\203\106\003\004\147\013\222\175\364\225\060\155\344\002\201\045\003\012\106\003\250"
+  "\033\134\347\377\377\276\367\154\104\005\003\045\003\106\003\250\033\134\337\201\377\377\001\372"
+  "\306\207\023\201\045\003\001\250\033\134\337\202\377\377\006\263\205\005\003\046\003\250\033\134"
+  "\337\377\377\230\266\201\377\377\010\215\114\046\003\250\033\134\337\377\377\162\175\263\205\377"
+  "\377\276\367\110\040\010\010\035\045\003\250\033\134\337\377\377\161\165\147\023\033\327\377\377"
+  "\045\003\250\033\134\337\377\377\161\165\304\002\154\104\377\377\106\003\250\033\134\337\377\377"
+  "\161\165\344\002\005\003\061\155\106\003\210\033\073\327\377\377\121\165\344\002\201\045\003\201"
+  "\106\003\003\310\033\351\043\207\023\045\003\201\105\003\201\243\001\201\202\001\000\242\001\202"
+  "\243\001\000\000\000\201\040\000\214\000\000\110\060\010\010\277\000\000\110\070\010\010\277\000"
+  "\000\002\341\000\120\030\010\010\207\000\000\000\106\003\201\045\003\201\106\003\202\045\003\005"
+  "\352\053\365\225\364\225\106\013\311\043\263\205\201\324\215\000\215\114\201\377\377\002\147\013"
+  "\114\074\276\367\201\377\377\000\215\114\201\377\377\005\147\023\012\064\372\306\073\327\337\377"
+  "\215\114\201\377\377\005\207\023\005\003\344\002\046\003\276\357\154\104\201\377\377\000\207\023"
+  "\201\045\003\002\207\023\276\357\357\144\201\377\377\000\207\023\201\045\003\001\207\023\276\357"
+  "\120\040\010\010\000\276\367\201\377\377\000\207\023\201\045\003\001\207\023\276\357\202\377\377"
+  "\000\207\023\201\045\003\001\207\023\276\357\202\377\377\000\207\023\201\045\003\002\207\023\276"
+  "\357\227\266\201\337\377\000\207\023\201\045\003\002\147\023\235\347\106\003\201\351\043\000\106"
+  "\003\201\105\003\002\106\003\351\043\243\001\201\202\001\203\243\001\000\202\001\217\000\000\120"
+  "\060\010\010\277\000\000\120\070\010\010\277\000\000"
+};